@@ -11,7 +11,13 @@
  * ------------
  */
 #include "CortexMx_OS_Porting.h"
+#include "Scheduler.h"
 
+const unsigned int OS_Syscall_BASEPRI = OS_Syscall_BASEPRI_Value;
+
+#if (MyRTOS_Max_Syscall_Interrupt_Priority > ((1 << __NVIC_PRIO_BITS) - 1))
+#error "MyRTOS_Max_Syscall_Interrupt_Priority is more than the lowest priority of the NVIC"
+#endif
 
 
 /* we make infinite loop for faults to avoid unpredictable thing if a fault is happen */
@@ -96,6 +102,24 @@ void HW_init(void)
 	IRQn_Type SysTick_Priority = SysTick_IRQn;
 	__NVIC_SetPriority(PendSV_Priority, SysTick_Priority);
 
+	/*
+	 * -------------------------------------------------------------------------------------------
+	 * | SVC takes the max syscall priority --> the interrupts that use the OS APIs can't        |
+	 * | interrupt the OS services and the interrupts with a higher priority are never delayed   |
+	 * -------------------------------------------------------------------------------------------
+	 */
+	__NVIC_SetPriority(SVCall_IRQn, MyRTOS_Max_Syscall_Interrupt_Priority);
+
+#if (MyRTOS_Context_Switch_Benchmark == 1) || (MyRTOS_Kernel_Call_Benchmark == 1)
+	/*
+	 * --------------------------------------------------------------------------
+	 * | Enable DWT Cycle Counter to measure the cycles of PendSV & kernel calls |
+	 * --------------------------------------------------------------------------
+	 */
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CYCCNT = 0;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
 
 }
 
@@ -104,6 +128,11 @@ void Trigger_OS_PendSV(void)
 	SCB->ICSR |= SCB_ICSR_PENDSVSET_Msk;
 }
 
+void Clear_OS_PendSV(void)
+{
+	SCB->ICSR = SCB_ICSR_PENDSVCLR_Msk;
+}
+
 unsigned int OS_Start_Ticker(void)
 {
 	/*
@@ -116,32 +145,230 @@ unsigned int OS_Start_Ticker(void)
 	 * | num_counts = 8000 count		  |
 	 * ------------------------------------
 	 */
-	return SysTick_Config(8000);
+	unsigned int Error = SysTick_Config(OS_Ticker_Counts_Per_Tick);
+
+	/*
+	 * SysTick_Config gives SysTick the lowest priority but we give it the max syscall priority
+	 * --> the interrupts that use the OS APIs can't preempt the tick handler between the start of the
+	 *     new tick (PENDSTSET is cleared) and Tick_Count++ so they never see a tick count behind SysTick
+	 */
+	NVIC_SetPriority(SysTick_IRQn, MyRTOS_Max_Syscall_Interrupt_Priority);
+
+	return Error;
+}
+
+/*
+ * Function Name : OS_Ticker_Start_Period
+ * Function [IN] : it takes the number of counts of the next period (2 or more)
+ * Function [OUT]: none
+ * Usage         : it's used to start one period of another length then return to the normal tick
+ *                 --> LOAD is written first and VAL is cleared so the counter reloads this period when it starts
+ *                 --> the normal LOAD is written only after the counter reloads (VAL isn't 0) because SysTick
+ *                     reloads LOAD at the next edge of its clock, so it's used at the end of this period only
+ */
+void OS_Ticker_Start_Period(unsigned int Counts)
+{
+	SysTick->LOAD = Counts - 1;
+	SysTick->VAL = 0;
+	SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+
+	//wait for the reload (one clock of SysTick at most)
+	while(SysTick->VAL == 0);
+
+	SysTick->LOAD = OS_Ticker_Counts_Per_Tick - 1;
+}
+
+/*
+ * Function Name : OS_Ticker_Suppress
+ * Function [IN] : it takes the number of ticks that the CPU can sleep without any tick interrupt
+ * Function [OUT]: it's return the number of ticks that are suppressed actually
+ * Usage         : it's used by tickless idle to make the next SysTick interrupt come after No_Ticks
+ *                 --> the 1st tick is the rest of the current tick (VAL) and the others are full ticks
+ *                 --> LOAD is set back to one tick after the counter reloads so the next period is normal
+ */
+unsigned int OS_Ticker_Suppress(unsigned int No_Ticks)
+{
+	unsigned int Counts;
+
+	if(No_Ticks > OS_Ticker_Max_Suppressed_Ticks)
+		No_Ticks = OS_Ticker_Max_Suppressed_Ticks;
+
+	//Stop the counter while we change its period
+	SysTick->CTRL &= ~SysTick_CTRL_ENABLE_Msk;
+
+	Counts = SysTick->VAL + ((No_Ticks - 1) * OS_Ticker_Counts_Per_Tick);
+	if(Counts < 2)
+		Counts = 2;
+
+	OS_Ticker_Start_Period(Counts);
+
+	return No_Ticks;
+}
+
+/*
+ * Function Name : OS_Ticker_Resume
+ * Function [IN] : it takes the number of ticks that are suppressed
+ * Function [OUT]: it's return the number of complete ticks that passed while the ticks were suppressed
+ * Usage         : it's used when the CPU wakes up from tickless idle to return to periodic ticks
+ *                 --> the last suppressed tick is never counted here because the SysTick interrupt
+ *                     (pending now or at the end of the current tick) will process it
+ */
+unsigned int OS_Ticker_Resume(unsigned int Suppressed_Ticks)
+{
+	unsigned int Ctrl, Remaining_Counts, Remaining_Ticks, Partial_Counts;
+
+	//Reading CTRL clears COUNTFLAG so we read it once
+	Ctrl = SysTick->CTRL;
+	SysTick->CTRL = Ctrl & ~SysTick_CTRL_ENABLE_Msk;
+
+	Remaining_Counts = SysTick->VAL;
+
+	if((Ctrl & SysTick_CTRL_COUNTFLAG_Msk) || (SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) || Remaining_Counts == 0)
+	{
+		//The whole period is finished and the counter is counting a normal tick now
+		SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+		return Suppressed_Ticks - 1;
+	}
+
+	//Ticks that still not finished (the current tick is one of them)
+	Remaining_Ticks = (Remaining_Counts + OS_Ticker_Counts_Per_Tick - 1) / OS_Ticker_Counts_Per_Tick;
+
+	//Complete the current tick only then return to the normal period
+	Partial_Counts = Remaining_Counts - ((Remaining_Ticks - 1) * OS_Ticker_Counts_Per_Tick);
+	if(Partial_Counts < 2)
+		Partial_Counts = 2;
+
+	OS_Ticker_Start_Period(Partial_Counts);
+
+	return Suppressed_Ticks - Remaining_Ticks;
+}
+
+/*
+ * Function Name : OS_Enter_Critical
+ * Function [IN] : none
+ * Function [OUT]: it's return the old value of BASEPRI (to restore it at the exit)
+ * Usage         : it's used to mask the interrupts with the max syscall priority or lower while the OS
+ *                 data is changed --> the interrupts with a higher priority are still served
+ *                 BASEPRI_MAX never decreases the mask so it can be nested (inside a critical section
+ *                 or an interrupt which has a higher priority than the max syscall priority)
+ */
+unsigned int OS_Enter_Critical(void)
+{
+	unsigned int Old_BASEPRI = __get_BASEPRI();
+
+	__set_BASEPRI_MAX(OS_Syscall_BASEPRI_Value);
+
+	return Old_BASEPRI;
+}
+
+/*
+ * Function Name : OS_Exit_Critical
+ * Function [IN] : it takes the old value of BASEPRI
+ * Function [OUT]: none
+ * Usage         : it's used to unmask the interrupts that are masked by OS_Enter_Critical
+ *                 --> a PendSV that is triggered inside the critical section is taken here
+ */
+void OS_Exit_Critical(unsigned int Old_BASEPRI)
+{
+	__set_BASEPRI(Old_BASEPRI);
+}
+
+/*
+ * Function Name : OS_ISR_Priority_Is_Valid
+ * Function [IN] : none
+ * Function [OUT]: it's return 1 if the active interrupt can call the OS APIs (FromISR) or 0 if not
+ * Usage         : an interrupt with a higher priority than the max syscall priority isn't masked by the OS
+ *                 critical sections so it must not change the OS data
+ *                 --> of the system exceptions only PendSV and SysTick (the OS exceptions) are valid
+ *                     (NMI and HardFault have fixed priorities above any BASEPRI mask)
+ */
+unsigned char OS_ISR_Priority_Is_Valid(void)
+{
+	unsigned int Active_Exception = __get_IPSR();
+	unsigned char Valid;
+
+	//External interrupts start from exception number 16 (IRQn = exception number - 16)
+	if(Active_Exception >= 16)
+		Valid = (NVIC_GetPriority((IRQn_Type)(Active_Exception - 16)) >= MyRTOS_Max_Syscall_Interrupt_Priority);
+	//thread mode and the OS exceptions (PendSV, SysTick) only --> NMI, faults, SVC and DebugMon aren't valid
+	else
+		Valid = (Active_Exception == 0 || Active_Exception == (PendSV_IRQn + 16) || Active_Exception == (SysTick_IRQn + 16));
+
+	return Valid;
+}
+
+/*
+ * Function Name : OS_Set_ISR_Priority
+ * Function [IN] : it takes the IRQ number of the interrupt and its priority
+ * Function [OUT]: none
+ * Usage         : it's used to set the NVIC priority of an interrupt with the same number of priority bits
+ *                 that OS_ISR_Priority_Is_Valid reads (the caller must be privileged)
+ */
+void OS_Set_ISR_Priority(unsigned int IRQ_Number, unsigned int Priority)
+{
+	NVIC_SetPriority((IRQn_Type)IRQ_Number, Priority);
+}
+
+/*
+ * Function Name : OS_Ticker_Elapsed_Counts
+ * Function [IN] : none
+ * Function [OUT]: it's return the number of counts that passed since the start of the current tick
+ * Usage         : it's used by the timestamp service (interrupts are masked or SysTick can't preempt the caller)
+ *                 the periodic ticks must be running (the caller exits tickless idle first) because
+ *                 LOAD and VAL have the counts of many ticks while they are suppressed
+ *                 --> if the tick is finished but its interrupt isn't processed yet (pending) the tick count
+ *                     doesn't have it so we read VAL again (it's in the new tick now) and add one tick of counts
+ */
+unsigned int OS_Ticker_Elapsed_Counts(void)
+{
+	unsigned int Counts = (OS_Ticker_Counts_Per_Tick - 1) - SysTick->VAL;
+
+	if(SCB->ICSR & SCB_ICSR_PENDSTSET_Msk)
+		Counts = OS_Ticker_Counts_Per_Tick + ((OS_Ticker_Counts_Per_Tick - 1) - SysTick->VAL);
+
+	return Counts;
 }
 
 unsigned char SysTick_Led;
 void SysTick_Handler(void)
 {
+	unsigned int Old_BASEPRI;
+
 	SysTick_Led ^= 1;
 
+	//the interrupts that use the OS APIs can't change the OS lists till we finish
+	Old_BASEPRI = OS_Enter_Critical();
+
+	/*
+	 * ----------------------------------------------------------------
+	 * |Count the ticks that are suppressed while IDLE Task sleeping  |
+	 * ----------------------------------------------------------------
+	 */
+	OS_Tickless_Idle_Exit();
+
 	/*
-	 * -----------------------------------------------
-	 * |Update Waiting Time for each task every tick |
-	 * -----------------------------------------------
+	 * --------------------------------------------------------------
+	 * |Update Tick Count & Waiting Time for each task every tick   |
+	 * --------------------------------------------------------------
 	 */
 	MyRTOS_Update_Waiting_Time();
 
 	/*
-	 * -----------------------------------
-	 * |Decide What task should run Next |
-	 * -----------------------------------
+	 * --------------------------------------------------------
+	 * |Round Robin between the tasks of the same priority    |
+	 * --------------------------------------------------------
 	 */
-	OS_Decide_What_Next();
+	OS_Round_Robin_Rotate();
 
 	/*
-	 * -----------------------------------------------------------
-	 * |Trigger OS_PendSV (Switch Context/Restore for our Tasks) |
-	 * -----------------------------------------------------------
+	 * ------------------------------------------------------------------------
+	 * |Decide What task should run Next                                      |
+	 * |Trigger OS_PendSV (Switch Context/Restore for our Tasks)              |
+	 * |only if the next task isn't the current task                          |
+	 * ------------------------------------------------------------------------
 	 */
-	Trigger_OS_PendSV();
+	if(OS_Decide_What_Next())
+		Trigger_OS_PendSV();
+
+	OS_Exit_Critical(Old_BASEPRI);
 }
@@ -0,0 +1,184 @@
+/*
+ * MYRTOS_Atomic.c
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: agent
+ */
+
+#include "MYRTOS_Atomic.h"
+
+/**
+ **********************************************************************************
+ * @function_name	: Atomic_Load
+ * @arguments		: pointer to the value
+ * @brief			: it's used to read the value (an aligned 32-bit read is one access)
+ * 					  and the reads after it can't be done before it.
+ **********************************************************************************
+ **/
+uint32_t Atomic_Load(volatile uint32_t *P_value)
+{
+	uint32_t value;
+
+#if (Atomic_Use_Exclusive_Access == 1)
+	value = *P_value;
+	Atomic_Memory_Barrier();
+#else
+	value = __atomic_load_n(P_value, __ATOMIC_SEQ_CST);
+#endif
+
+	return value;
+}
+
+/**
+ **********************************************************************************
+ * @function_name	: Atomic_Store
+ * @arguments		: pointer to the value, new value
+ * @brief			: it's used to write the value (an aligned 32-bit write is one access)
+ * 					  after all memory accesses before it are finished.
+ **********************************************************************************
+ **/
+void Atomic_Store(volatile uint32_t *P_value, uint32_t value)
+{
+#if (Atomic_Use_Exclusive_Access == 1)
+	Atomic_Memory_Barrier();
+	*P_value = value;
+	Atomic_Memory_Barrier();
+#else
+	__atomic_store_n(P_value, value, __ATOMIC_SEQ_CST);
+#endif
+}
+
+/**
+ **********************************************************************************
+ * @function_name	: Atomic_Exchange
+ * @arguments		: pointer to the value, new value
+ * @brief			: it's used to write the new value and return the old one in one atomic step.
+ **********************************************************************************
+ **/
+uint32_t Atomic_Exchange(volatile uint32_t *P_value, uint32_t value)
+{
+	uint32_t old_value;
+
+#if (Atomic_Use_Exclusive_Access == 1)
+	Atomic_Memory_Barrier();
+	do
+	{
+		old_value = __LDREXW(P_value);
+	}while(__STREXW(value, P_value) != 0);
+	Atomic_Memory_Barrier();
+#else
+	old_value = __atomic_exchange_n(P_value, value, __ATOMIC_SEQ_CST);
+#endif
+
+	return old_value;
+}
+
+/**
+ **********************************************************************************
+ * @function_name	: Atomic_Compare_Exchange
+ * @arguments		: pointer to the value, pointer to the expected value, new value
+ * @brief			: it's used to write the new value only if the value is still the expected one (CAS).
+ * 					  if it isn't, the current value is returned in the expected value.
+ * @return			: 1 --> the new value is written, 0 --> the value was changed by someone else
+ **********************************************************************************
+ **/
+uint8_t Atomic_Compare_Exchange(volatile uint32_t *P_value, uint32_t *P_expected, uint32_t desired)
+{
+	uint8_t result = 1;
+
+#if (Atomic_Use_Exclusive_Access == 1)
+	uint32_t current;
+
+	Atomic_Memory_Barrier();
+	do
+	{
+		current = __LDREXW(P_value);
+		if(current != *P_expected)
+		{
+			__CLREX();
+			*P_expected = current;
+			result = 0;
+		}
+	}while(result == 1 && __STREXW(desired, P_value) != 0);
+	Atomic_Memory_Barrier();
+#else
+	result = __atomic_compare_exchange_n(P_value, P_expected, desired, 0, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+#endif
+
+	return result;
+}
+
+/**
+ **********************************************************************************
+ * @function_name	: Atomic_Fetch_Add
+ * @arguments		: pointer to the value, value to add
+ * @brief			: it's used to add to the value (ex: shared counter) and return the old value.
+ **********************************************************************************
+ **/
+uint32_t Atomic_Fetch_Add(volatile uint32_t *P_value, uint32_t value)
+{
+	uint32_t old_value;
+
+#if (Atomic_Use_Exclusive_Access == 1)
+	Atomic_Memory_Barrier();
+	do
+	{
+		old_value = __LDREXW(P_value);
+	}while(__STREXW(old_value + value, P_value) != 0);
+	Atomic_Memory_Barrier();
+#else
+	old_value = __atomic_fetch_add(P_value, value, __ATOMIC_SEQ_CST);
+#endif
+
+	return old_value;
+}
+
+/**
+ **********************************************************************************
+ * @function_name	: Atomic_Fetch_Or
+ * @arguments		: pointer to the value, bits to set
+ * @brief			: it's used to set bits of the value (ex: shared flags) and return the old value.
+ **********************************************************************************
+ **/
+uint32_t Atomic_Fetch_Or(volatile uint32_t *P_value, uint32_t value)
+{
+	uint32_t old_value;
+
+#if (Atomic_Use_Exclusive_Access == 1)
+	Atomic_Memory_Barrier();
+	do
+	{
+		old_value = __LDREXW(P_value);
+	}while(__STREXW(old_value | value, P_value) != 0);
+	Atomic_Memory_Barrier();
+#else
+	old_value = __atomic_fetch_or(P_value, value, __ATOMIC_SEQ_CST);
+#endif
+
+	return old_value;
+}
+
+/**
+ **********************************************************************************
+ * @function_name	: Atomic_Fetch_And
+ * @arguments		: pointer to the value, mask of the bits to keep
+ * @brief			: it's used to clear bits of the value and return the old value.
+ **********************************************************************************
+ **/
+uint32_t Atomic_Fetch_And(volatile uint32_t *P_value, uint32_t value)
+{
+	uint32_t old_value;
+
+#if (Atomic_Use_Exclusive_Access == 1)
+	Atomic_Memory_Barrier();
+	do
+	{
+		old_value = __LDREXW(P_value);
+	}while(__STREXW(old_value & value, P_value) != 0);
+	Atomic_Memory_Barrier();
+#else
+	old_value = __atomic_fetch_and(P_value, value, __ATOMIC_SEQ_CST);
+#endif
+
+	return old_value;
+}
@@ -10,21 +10,26 @@
 /**
  **********************************************************************************
  * @function_name	: FIFO_init
- * @arguments		: pointer to LIFO, pointer to Buffer, length of buffer
+ * @arguments		: pointer to FIFO, pointer to Buffer, length of buffer (items), size of one item (bytes)
  * @brief			: it's used to initialize the FIFO to be ready to use it.
  **********************************************************************************
  **/
-FIFO_Buf_Status FIFO_init (FIFO_Buf_t *P_fifo, FIFO_element_type *buf, uint32_t length)
+FIFO_Buf_Status FIFO_init (FIFO_Buf_t *P_fifo, void *buf, uint32_t length, uint32_t item_size)
 {
 	//check if buffer is reserved at memory or not
-	if(buf == NULL)
+	if(buf == NULL || length == 0 || item_size == 0)
+		return FIFO_null;
+
+	//the size of the buffer (length * item_size) must fit in 32 bits
+	if(length > UINT32_MAX / item_size)
 		return FIFO_null;
 
 	//initialize fifo
 	P_fifo->base = buf;
-	P_fifo->tail = P_fifo->base;
-	P_fifo->head = P_fifo->base;
+	P_fifo->head = 0;
+	P_fifo->tail = 0;
 	P_fifo->length = length;
+	P_fifo->item_size = item_size;
 	P_fifo->count = 0;
 
 	return FIFO_no_error;
@@ -34,14 +39,14 @@ FIFO_Buf_Status FIFO_init (FIFO_Buf_t *P_fifo, FIFO_element_type *buf, uint32_t
 /**
  **********************************************************************************
  * @function_name	: FIFO_IS_FULL
- * @arguments		: pointer to LIFO
+ * @arguments		: pointer to FIFO
  * @brief			: it's used to check if fifo is full or not.
  **********************************************************************************
  **/
 FIFO_Buf_Status FIFO_IS_FULL(FIFO_Buf_t *P_fifo)
 {
 	//check if fifo is valid or not.
-	if(!P_fifo->base || !P_fifo->tail || !P_fifo->head)
+	if(!P_fifo->base)
 		return FIFO_null;
 
 	if(P_fifo->count == P_fifo->length)
@@ -53,14 +58,14 @@ FIFO_Buf_Status FIFO_IS_FULL(FIFO_Buf_t *P_fifo)
 /**
  **********************************************************************************
  * @function_name	: FIFO_IS_EMPTY
- * @arguments		: pointer to LIFO
+ * @arguments		: pointer to FIFO
  * @brief			: it's used to check if fifo is empty or not.
  **********************************************************************************
  **/
 FIFO_Buf_Status FIFO_IS_EMPTY(FIFO_Buf_t *P_fifo)
 {
 	//check if fifo is valid or not.
-	if(!P_fifo->base || !P_fifo->tail || !P_fifo->head)
+	if(!P_fifo->base)
 		return FIFO_null;
 
 	if(P_fifo->count == 0)
@@ -72,27 +77,27 @@ FIFO_Buf_Status FIFO_IS_EMPTY(FIFO_Buf_t *P_fifo)
 /**
  **********************************************************************************
  * @function_name	: FIFO_Enqueue_Item
- * @arguments		: pointer to LIFO, item value to enqueue it.
+ * @arguments		: pointer to FIFO, pointer to the item to enqueue it (item_size bytes are copied).
  * @brief			: it's used to enqueue value to the fifo.
  **********************************************************************************
  **/
-FIFO_Buf_Status FIFO_Enqueue_Item(FIFO_Buf_t *P_fifo, FIFO_element_type item)
+FIFO_Buf_Status FIFO_Enqueue_Item(FIFO_Buf_t *P_fifo, const void *item)
 {
 	//check if fifo is valid or not.
-	if(!P_fifo->base || !P_fifo->tail || !P_fifo->head)
+	if(!P_fifo->base)
 		return FIFO_null;
 
 	//check if fifo is full or not
-	if(FIFO_IS_FULL(P_fifo) == FIFO_full)
+	if(P_fifo->count == P_fifo->length)
 		return FIFO_full;
 
 	//enqueue the item to fifo
-	*(P_fifo->head) = item;
+	memcpy(P_fifo->base + (P_fifo->head * P_fifo->item_size), item, P_fifo->item_size);
 	P_fifo->count++;
 
-	//check if head at the end of queue or not.
-	if(P_fifo->head == (P_fifo->base + P_fifo->length))
-		P_fifo->head = P_fifo->base;
+	//check if head is the last item of the buffer or not.
+	if(P_fifo->head == (P_fifo->length - 1))
+		P_fifo->head = 0;
 	else
 		P_fifo->head++;
 
@@ -102,30 +107,29 @@ FIFO_Buf_Status FIFO_Enqueue_Item(FIFO_Buf_t *P_fifo, FIFO_element_type item)
 /**
  **********************************************************************************
  * @function_name	: FIFO_Dequeue_Item
- * @arguments		: pointer to LIFO, pointer to the item dequeued from fifo.
+ * @arguments		: pointer to FIFO, pointer to the item dequeued from fifo (item_size bytes are copied).
  * @brief			: it's used to dequeue value from the fifo.
  **********************************************************************************
  **/
-FIFO_Buf_Status FIFO_Dequeue_Item(FIFO_Buf_t *P_fifo, FIFO_element_type *item)
+FIFO_Buf_Status FIFO_Dequeue_Item(FIFO_Buf_t *P_fifo, void *item)
 {
 	//check if fifo is valid or not.
-	if(!P_fifo->base || !P_fifo->tail || !P_fifo->head)
+	if(!P_fifo->base)
 		return FIFO_null;
 
 	//check if the fifo is empty or not.
-	if(FIFO_IS_EMPTY(P_fifo) == FIFO_empty)
+	if(P_fifo->count == 0)
 		return FIFO_empty;
 
 	//dequeue the item from fifo
-	*item = *(P_fifo->tail);
+	memcpy(item, P_fifo->base + (P_fifo->tail * P_fifo->item_size), P_fifo->item_size);
 	P_fifo->count--;
 
-	//check if tail at the end of queue or not.
-	if(P_fifo->tail == (P_fifo->base + P_fifo->length))
-		P_fifo->tail = P_fifo->base;
+	//check if tail is the last item of the buffer or not.
+	if(P_fifo->tail == (P_fifo->length - 1))
+		P_fifo->tail = 0;
 	else
 		P_fifo->tail++;
 
 	return FIFO_no_error;
 }
-
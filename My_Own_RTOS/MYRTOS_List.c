@@ -0,0 +1,165 @@
+/*
+ * MYRTOS_List.c
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: agent
+ */
+
+#include "MYRTOS_List.h"
+
+/**
+ **********************************************************************************
+ * @function_name	: List_Init
+ * @arguments		: pointer to list
+ * @brief			: it's used to initialize the list to be empty.
+ **********************************************************************************
+ **/
+void List_Init(List_t *P_List)
+{
+	P_List->Head = NULL;
+	P_List->Tail = NULL;
+	P_List->Count = 0;
+}
+
+/**
+ **********************************************************************************
+ * @function_name	: List_Node_Init
+ * @arguments		: pointer to node, pointer to the object which contains the node
+ * @brief			: it's used to initialize the node to be not linked to any list.
+ **********************************************************************************
+ **/
+void List_Node_Init(List_Node_t *P_Node, void *Owner)
+{
+	P_Node->Next = NULL;
+	P_Node->Prev = NULL;
+	P_Node->Item_Value = 0;
+	P_Node->Owner = Owner;
+	P_Node->Container = NULL;
+}
+
+/**
+ **********************************************************************************
+ * @function_name	: List_Insert_Head
+ * @arguments		: pointer to list, pointer to node
+ * @brief			: it's used to insert the node at the head of the list.
+ **********************************************************************************
+ **/
+void List_Insert_Head(List_t *P_List, List_Node_t *P_Node)
+{
+	P_Node->Prev = NULL;
+	P_Node->Next = P_List->Head;
+
+	if(P_List->Head != NULL)
+		P_List->Head->Prev = P_Node;
+	else
+		P_List->Tail = P_Node;
+
+	P_List->Head = P_Node;
+	P_Node->Container = P_List;
+	P_List->Count++;
+}
+
+/**
+ **********************************************************************************
+ * @function_name	: List_Insert_Tail
+ * @arguments		: pointer to list, pointer to node
+ * @brief			: it's used to insert the node at the tail of the list (FIFO order).
+ **********************************************************************************
+ **/
+void List_Insert_Tail(List_t *P_List, List_Node_t *P_Node)
+{
+	P_Node->Next = NULL;
+	P_Node->Prev = P_List->Tail;
+
+	if(P_List->Tail != NULL)
+		P_List->Tail->Next = P_Node;
+	else
+		P_List->Head = P_Node;
+
+	P_List->Tail = P_Node;
+	P_Node->Container = P_List;
+	P_List->Count++;
+}
+
+/**
+ **********************************************************************************
+ * @function_name	: List_Insert_Before
+ * @arguments		: pointer to list, pointer to the node of the position, pointer to node
+ * @brief			: it's used to insert the node before the position node.
+ * 					  if the position is NULL the node is inserted at the tail.
+ **********************************************************************************
+ **/
+void List_Insert_Before(List_t *P_List, List_Node_t *P_Position, List_Node_t *P_Node)
+{
+	if(P_Position == NULL)
+	{
+		List_Insert_Tail(P_List, P_Node);
+	}
+	else if(P_Position == P_List->Head)
+	{
+		List_Insert_Head(P_List, P_Node);
+	}
+	else
+	{
+		P_Node->Next = P_Position;
+		P_Node->Prev = P_Position->Prev;
+		P_Position->Prev->Next = P_Node;
+		P_Position->Prev = P_Node;
+
+		P_Node->Container = P_List;
+		P_List->Count++;
+	}
+}
+
+/**
+ **********************************************************************************
+ * @function_name	: List_Insert_Ordered
+ * @arguments		: pointer to list, pointer to node (its Item_Value is filled)
+ * @brief			: it's used to insert the node in ascending order of Item_Value.
+ * 					  the node is inserted after the nodes that have the same value
+ * 					  so the nodes with the same value keep FIFO order.
+ * 					  values are compared by their signed difference so the order
+ * 					  is still right when a tick based value wraps around.
+ **********************************************************************************
+ **/
+void List_Insert_Ordered(List_t *P_List, List_Node_t *P_Node)
+{
+	List_Node_t *P_Iterator = P_List->Head;
+
+	//search for the first node which has a greater value
+	while(P_Iterator != NULL && (int)(P_Node->Item_Value - P_Iterator->Item_Value) >= 0)
+		P_Iterator = P_Iterator->Next;
+
+	List_Insert_Before(P_List, P_Iterator, P_Node);
+}
+
+/**
+ **********************************************************************************
+ * @function_name	: List_Remove
+ * @arguments		: pointer to node
+ * @brief			: it's used to remove the node from the list which contains it.
+ **********************************************************************************
+ **/
+void List_Remove(List_Node_t *P_Node)
+{
+	List_t *P_List = P_Node->Container;
+
+	//check if the node is linked to a list or not
+	if(P_List == NULL)
+		return;
+
+	if(P_Node->Prev != NULL)
+		P_Node->Prev->Next = P_Node->Next;
+	else
+		P_List->Head = P_Node->Next;
+
+	if(P_Node->Next != NULL)
+		P_Node->Next->Prev = P_Node->Prev;
+	else
+		P_List->Tail = P_Node->Prev;
+
+	P_Node->Next = NULL;
+	P_Node->Prev = NULL;
+	P_Node->Container = NULL;
+	P_List->Count--;
+}
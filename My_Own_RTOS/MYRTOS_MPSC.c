@@ -0,0 +1,112 @@
+/*
+ * MYRTOS_MPSC.c
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: agent
+ */
+
+#include "MYRTOS_MPSC.h"
+
+/**
+ **********************************************************************************
+ * @function_name	: MPSC_init
+ * @arguments		: pointer to queue, pointer to the slots, number of slots (power of two)
+ * @brief			: it's used to initialize the queue to be empty (slot i is free for position i).
+ * 					  it's called before the producers and the consumer start.
+ **********************************************************************************
+ **/
+MPSC_Buf_Status MPSC_init(MPSC_Buf_t *P_queue, MPSC_Slot_t *slots, uint32_t length)
+{
+	uint32_t i;
+
+	//check if slots are reserved at memory and the length is a power of two or not
+	if(slots == NULL || length < 2 || (length & (length - 1)) != 0 || length > 0x80000000UL)
+		return MPSC_null;
+
+	for(i = 0; i < length; i++)
+		slots[i].sequence = i;
+
+	P_queue->slots = slots;
+	P_queue->mask = length - 1;
+	P_queue->head = 0;
+	P_queue->tail = 0;
+
+	return MPSC_no_error;
+}
+
+/**
+ **********************************************************************************
+ * @function_name	: MPSC_Post
+ * @arguments		: pointer to queue, item
+ * @brief			: it's used by any producer (task or ISR) to post the item without disabling interrupts.
+ * 					  --> the position is reserved by compare and swap on head, if another producer takes it
+ * 					      first the CAS fails and the producer tries again with the new head
+ * 					  --> the item is written then the sequence of its slot publishes it to the consumer
+ **********************************************************************************
+ **/
+MPSC_Buf_Status MPSC_Post(MPSC_Buf_t *P_queue, uint32_t item)
+{
+	MPSC_Slot_t *slot;
+	uint32_t position = Atomic_Load(&P_queue->head);
+	int32_t diff;
+
+	for(;;)
+	{
+		slot = &P_queue->slots[position & P_queue->mask];
+		diff = (int32_t)(slot->sequence - position);
+
+		//the consumer didn't read the item of the last round of this slot
+		if(diff < 0)
+			return MPSC_full;
+
+		//the slot is free for this position --> try to reserve it
+		//(if it fails, position has the new head)
+		if(diff == 0)
+		{
+			if(Atomic_Compare_Exchange(&P_queue->head, &position, position + 1))
+				break;
+		}
+		else
+		{
+			//another producer reserved this position first
+			position = Atomic_Load(&P_queue->head);
+		}
+	}
+
+	slot->data = item;
+
+	//the item must be in the memory before the consumer sees the new sequence
+	Atomic_Memory_Barrier();
+	slot->sequence = position + 1;
+
+	return MPSC_no_error;
+}
+
+/**
+ **********************************************************************************
+ * @function_name	: MPSC_Get
+ * @arguments		: pointer to queue, pointer to the item
+ * @brief			: it's used by the consumer only to read the oldest item.
+ * 					  if the oldest position is reserved but its producer didn't finish it yet
+ * 					  the queue is empty for now (the items after it wait in their order).
+ **********************************************************************************
+ **/
+MPSC_Buf_Status MPSC_Get(MPSC_Buf_t *P_queue, uint32_t *item)
+{
+	uint32_t position = P_queue->tail;
+	MPSC_Slot_t *slot = &P_queue->slots[position & P_queue->mask];
+
+	if(slot->sequence != position + 1)
+		return MPSC_empty;
+
+	//the item is read after its sequence
+	Atomic_Memory_Barrier();
+	*item = slot->data;
+
+	//the item must be read before the producers reuse the slot
+	Atomic_Memory_Barrier();
+	slot->sequence = position + P_queue->mask + 1;
+	P_queue->tail = position + 1;
+
+	return MPSC_no_error;
+}
@@ -0,0 +1,137 @@
+/*
+ * MYRTOS_Ring.c
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: agent
+ */
+
+#include "MYRTOS_Ring.h"
+
+/**
+ **********************************************************************************
+ * @function_name	: Ring_init
+ * @arguments		: pointer to ring, pointer to Buffer, length of buffer (items, power of two), size of one item (bytes)
+ * @brief			: it's used to initialize the ring to be empty.
+ * 					  it's called before the producer and the consumer start.
+ **********************************************************************************
+ **/
+Ring_Buf_Status Ring_init(Ring_Buf_t *P_ring, void *buf, uint32_t length, uint32_t item_size)
+{
+	//check if buffer is reserved at memory and the length is a power of two or not
+	if(buf == NULL || item_size == 0 || length == 0 || (length & (length - 1)) != 0 || length > 0x80000000UL)
+		return Ring_null;
+
+	P_ring->base = buf;
+	P_ring->item_size = item_size;
+	P_ring->mask = length - 1;
+	P_ring->head = 0;
+	P_ring->tail = 0;
+
+	return Ring_no_error;
+}
+
+/**
+ **********************************************************************************
+ * @function_name	: Ring_Push_N
+ * @arguments		: pointer to ring, pointer to the items, number of items
+ * @brief			: it's used by the producer only to copy up to n items to the ring.
+ * 					  the items are copied by two memcpy at most (before and after the end of the buffer)
+ * 					  then head is written one time so the consumer sees all of them together.
+ * @return			: number of the pushed items (less than n if the ring becomes full)
+ **********************************************************************************
+ **/
+uint32_t Ring_Push_N(Ring_Buf_t *P_ring, const void *items, uint32_t n)
+{
+	uint32_t head = P_ring->head;
+	uint32_t free_items = Ring_Length(P_ring) - (head - P_ring->tail);
+	uint32_t index, first_part;
+
+	if(n > free_items)
+		n = free_items;
+
+	if(n != 0)
+	{
+		index = head & P_ring->mask;
+		first_part = Ring_Length(P_ring) - index;
+		if(first_part > n)
+			first_part = n;
+
+		memcpy(P_ring->base + (index * P_ring->item_size), items, first_part * P_ring->item_size);
+		memcpy(P_ring->base, (const uint8_t *)items + (first_part * P_ring->item_size), (n - first_part) * P_ring->item_size);
+
+		//the items must be in the memory before the consumer sees the new head
+		Atomic_Memory_Barrier();
+		P_ring->head = head + n;
+	}
+
+	return n;
+}
+
+/**
+ **********************************************************************************
+ * @function_name	: Ring_Pop_N
+ * @arguments		: pointer to ring, pointer to the buffer of the items, max number of items
+ * @brief			: it's used by the consumer only to copy up to n items from the ring.
+ * 					  tail is written one time after the copy so the producer reuses the places after it.
+ * @return			: number of the popped items (less than n if the ring becomes empty)
+ **********************************************************************************
+ **/
+uint32_t Ring_Pop_N(Ring_Buf_t *P_ring, void *items, uint32_t n)
+{
+	uint32_t tail = P_ring->tail;
+	uint32_t count = P_ring->head - tail;
+	uint32_t index, first_part;
+
+	if(n > count)
+		n = count;
+
+	if(n != 0)
+	{
+		//the items are read after head (the producer wrote them before it)
+		Atomic_Memory_Barrier();
+
+		index = tail & P_ring->mask;
+		first_part = Ring_Length(P_ring) - index;
+		if(first_part > n)
+			first_part = n;
+
+		memcpy(items, P_ring->base + (index * P_ring->item_size), first_part * P_ring->item_size);
+		memcpy((uint8_t *)items + (first_part * P_ring->item_size), P_ring->base, (n - first_part) * P_ring->item_size);
+
+		//the items must be read before the producer sees the free places
+		Atomic_Memory_Barrier();
+		P_ring->tail = tail + n;
+	}
+
+	return n;
+}
+
+/**
+ **********************************************************************************
+ * @function_name	: Ring_Push
+ * @arguments		: pointer to ring, pointer to the item
+ * @brief			: it's used by the producer only to copy one item to the ring.
+ **********************************************************************************
+ **/
+Ring_Buf_Status Ring_Push(Ring_Buf_t *P_ring, const void *item)
+{
+	if(Ring_Push_N(P_ring, item, 1) == 0)
+		return Ring_full;
+
+	return Ring_no_error;
+}
+
+/**
+ **********************************************************************************
+ * @function_name	: Ring_Pop
+ * @arguments		: pointer to ring, pointer to the item
+ * @brief			: it's used by the consumer only to copy one item from the ring.
+ **********************************************************************************
+ **/
+Ring_Buf_Status Ring_Pop(Ring_Buf_t *P_ring, void *item)
+{
+	if(Ring_Pop_N(P_ring, item, 1) == 0)
+		return Ring_empty;
+
+	return Ring_no_error;
+}
@@ -11,14 +11,32 @@
  * ------------
  */
 #include "Scheduler.h"
-#include "MYRTOS_FIFO.h"
+#include "string.h"
 
 //define a macro contain the maximum number of tasks
 #define Max_Num_of_Tasks			100
 
-//Ready Queue Buffer
-FIFO_Buf_t Ready_Queue;
-Task_Ref_t* Ready_Queue_FIFO[Max_Num_of_Tasks];
+/*
+ * Ready Lists:
+ * --> one FIFO (intrusive list) for each priority level
+ * --> bit (31 - Priority) of the bitmap is set when the list of this priority has ready tasks
+ *     so the highest ready priority = number of leading zeros of the bitmap (one CLZ instruction)
+ */
+List_t Ready_Lists[MyRTOS_Num_of_Priorities];
+unsigned int Ready_Priority_Bitmap;
+
+#define Priority_Bitmap_Mask(Priority)		(1UL << (31 - (Priority)))
+
+/*
+ * Delayed List (Delta List):
+ * --> the tasks which wait for a number of ticks sorted by their wake-up time
+ * --> Item_Value of each node = number of ticks after the node before it
+ *     so every tick we decrement the head only
+ */
+List_t Delayed_List;
+
+//Time Slice (in ticks) of Round Robin for each priority level
+unsigned int Time_Slice_Ticks[MyRTOS_Num_of_Priorities];
 
 //Idle Task
 Task_Ref_t MyRTOS_IDLE_TASK;
@@ -37,6 +55,12 @@ enum OS_Mode_t
 //-*-*-*-*-*-*-*-*-*-*-*-*-*-*-
 struct
 {
+	//Current_Task, Next_Task & Context_Switch_Count must be the first three members because
+	//PendSV_Handler (assembly) reads them at offsets 0, 4 and 8
+	Task_Ref_t* Current_Task;
+	Task_Ref_t* Next_Task;
+	unsigned int Context_Switch_Count;			//Number of context switches done by PendSV (Next_Task != Current_Task)
+
 	Task_Ref_t* OS_Tasks[Max_Num_of_Tasks];	//Task Scheduler Table
 
 	unsigned int _S_MSP_OS;
@@ -45,19 +69,144 @@ struct
 
 	unsigned int No_of_Active_Tasks;
 
-	Task_Ref_t* Current_Task;
-	Task_Ref_t* Next_Task;
-
 	enum OS_Mode_t OS_State;
 
+	unsigned int Context_Switch_Avoided_Count;	//Number of decisions that keep the current task (no PendSV)
+
+	unsigned int Time_Slice_Remaining;	//Ticks that the current task can still run before Round Robin
+
+	unsigned long long Tick_Count;	//Number of ticks since the OS is started (64-bit --> it never wraps)
+	unsigned int Suppressed_Ticks;	//Number of ticks suppressed by tickless idle (0 --> periodic ticks)
+
+	unsigned int Critical_Nesting;		//Number of MyRTOS_Enter_Critical without MyRTOS_Exit_Critical
+	unsigned int Critical_Old_BASEPRI;	//BASEPRI before the first MyRTOS_Enter_Critical
+
 }OS_Control_t;
 
+/*
+ * Enumeration Name: SVC_ID_t
+ * Usage:          : it has all cases of SVC IDs (the index of the service in OS_SVC_Table)
+ */
+typedef enum
+{
+	SVC_Activate_Task = 1,
+	SVC_Terminate_Task,
+	SVC_Task_Waiting_Time,
+	SVC_Acquire_Mutex,
+	SVC_Release_Mutex,
+	SVC_Tickless_Idle,
+	SVC_Task_Wait_Until,
+	SVC_Get_Timestamp,
+	SVC_Take_Semaphore,
+	SVC_Give_Semaphore,
+	SVC_Wait_Event_Flags,
+	SVC_Set_Event_Flags,
+	SVC_Clear_Event_Flags,
+	SVC_Task_Notify,
+	SVC_Task_Notify_Wait,
+	SVC_Queue_Send,
+	SVC_Queue_Receive,
+	SVC_Num_of_Services
+}SVC_ID_t;
+
+/*
+ * OS Services:
+ * --> each service takes a pointer to the stacked R0-R3 of the caller (its arguments)
+ *     and its return value is written back to the stacked R0 (the caller sees it in R0)
+ */
+typedef unsigned int (*OS_SVC_Service_t)(unsigned int *SVC_Args);
+
+unsigned int OS_SVC_Acquire_Mutex(unsigned int *SVC_Args);
+unsigned int OS_SVC_Release_Mutex(unsigned int *SVC_Args);
+void OS_Mutex_Release(Mutex_Configuration_t *Mutex_Config);
+void OS_Mutex_Leave_Wait_List(Task_Ref_t *Task_Ref_Config);
+unsigned int OS_SVC_Take_Semaphore(unsigned int *SVC_Args);
+unsigned int OS_SVC_Give_Semaphore(unsigned int *SVC_Args);
+unsigned int OS_SVC_Wait_Event_Flags(unsigned int *SVC_Args);
+unsigned int OS_SVC_Set_Event_Flags(unsigned int *SVC_Args);
+unsigned int OS_SVC_Clear_Event_Flags(unsigned int *SVC_Args);
+unsigned int OS_SVC_Task_Notify(unsigned int *SVC_Args);
+unsigned int OS_SVC_Task_Notify_Wait(unsigned int *SVC_Args);
+unsigned int OS_SVC_Queue_Send(unsigned int *SVC_Args);
+unsigned int OS_SVC_Queue_Receive(unsigned int *SVC_Args);
+
+/*
+ * Macro: OS_SVC_Call
+ * How:
+ * 		--> Put the arguments in R0-R3 (AAPCS argument registers)
+ * 		--> SVC #SVC_ID (the ID is an immediate so it must be a constant)
+ * 		--> the OS writes the return value to the stacked R0 so we read it from R0 after SVC
+ */
+#define OS_SVC_Call(SVC_ID, Arg0, Arg1, Arg2, Arg3)																\
+	({																											\
+		register unsigned int SVC_R0 __asm("r0") = (unsigned int)(Arg0);										\
+		register unsigned int SVC_R1 __asm("r1") = (unsigned int)(Arg1);										\
+		register unsigned int SVC_R2 __asm("r2") = (unsigned int)(Arg2);										\
+		register unsigned int SVC_R3 __asm("r3") = (unsigned int)(Arg3);										\
+		__asm volatile("SVC %[ID]" : "+r" (SVC_R0) : [ID] "i" (SVC_ID), "r" (SVC_R1), "r" (SVC_R2), "r" (SVC_R3)	\
+						: "memory");																			\
+		SVC_R0;																									\
+	})
+
+unsigned int OS_Direct_Call(SVC_ID_t SVC_ID, unsigned int Arg0, unsigned int Arg1, unsigned int Arg2, unsigned int Arg3);
+
+/*
+ * Macro: OS_Call
+ * How:
+ * 		--> inside MyRTOS_Enter_Critical --> ES_Error_In_Critical (SVC is masked by BASEPRI so it would
+ * 			escalate to HardFault, and a blocking service can't switch the task while PendSV is masked)
+ * 		--> privileged thread mode (startup code or privileged task) --> direct call (no exception)
+ * 		--> unprivileged task --> SVC
+ */
+#define OS_Caller_In_Critical()						(OS_Control_t.Critical_Nesting != 0)
+#if (MyRTOS_Privileged_Fast_Path == 1)
+#define OS_Caller_Is_Privileged()					(__get_IPSR() == 0 && (__get_CONTROL() & 0x1) == 0)
+#define OS_Call(SVC_ID, Arg0, Arg1, Arg2, Arg3)		(OS_Caller_In_Critical() ? (unsigned int)ES_Error_In_Critical :										\
+													 OS_Caller_Is_Privileged() ?																		\
+													 OS_Direct_Call(SVC_ID, (unsigned int)(Arg0), (unsigned int)(Arg1), (unsigned int)(Arg2), (unsigned int)(Arg3)) :	\
+													 OS_SVC_Call(SVC_ID, Arg0, Arg1, Arg2, Arg3))
+#else
+#define OS_Call(SVC_ID, Arg0, Arg1, Arg2, Arg3)		(OS_Caller_In_Critical() ? (unsigned int)ES_Error_In_Critical :										\
+													 OS_SVC_Call(SVC_ID, Arg0, Arg1, Arg2, Arg3))
+#endif
+
+//PendSV_Handler is written in assembly so it depends on these offsets
+_Static_assert(offsetof(Task_Ref_t, Current_PSP_Task) == 0, "PendSV_Handler reads Current_PSP_Task at offset 0");
+#if (__SIZEOF_POINTER__ == 4)
+_Static_assert(offsetof(__typeof__(OS_Control_t), Next_Task) == 4, "PendSV_Handler reads Next_Task at offset 4");
+_Static_assert(offsetof(__typeof__(OS_Control_t), Context_Switch_Count) == 8, "PendSV_Handler updates Context_Switch_Count at offset 8");
+#endif
+
+#if (MyRTOS_Context_Switch_Benchmark == 1)
+//-*-*-*-*-*-*-*-*-*-*-*-*-*-*-
+//Context Switch Benchmark: (cycles of PendSV_Handler)
+//-*-*-*-*-*-*-*-*-*-*-*-*-*-*-
+struct
+{
+	unsigned int Last_Cycles;
+	unsigned int Max_Cycles;
+}OS_Context_Switch_Benchmark;
+#endif
+
+#if (MyRTOS_Kernel_Call_Benchmark == 1)
+//-*-*-*-*-*-*-*-*-*-*-*-*-*-*-
+//Kernel Call Benchmark: (cycles of one call --> [0] by SVC, [1] by direct call)
+//-*-*-*-*-*-*-*-*-*-*-*-*-*-*-
+struct
+{
+	unsigned int Activate_Cycles[2];
+	unsigned int Terminate_Cycles[2];
+	unsigned int Acquire_Mutex_Cycles[2];
+	unsigned int Release_Mutex_Cycles[2];
+}OS_Kernel_Call_Benchmark;
+#endif
+
 
 /*
  *          ^
  * Priority |
  *          |                 -------                      -------
- *          |                 | SVC |                      | SVC |		<--- Reorder Scheduler Table, Update Ready Queue
+ *          |                 | SVC |                      | SVC |		<--- Update Ready Lists of the task
  *          |                 -------                      -------
  *          |                |       |                    |       |
  *          |                |       |                    |       |
@@ -132,19 +281,24 @@ struct
  * Function [OUT]: none
  * Usage         : it's PendSV handler and we use it to make context switch to the current task
  *                 and context restore for the next task
+ *                 --> it's written in assembly because it must not use the stack (naked) and
+ *                     it saves/restores R4 to R11 with one instruction (STMDB/LDMIA)
  */
 __attribute ((naked)) void PendSV_Handler(void)
 {
-	//Switch Context/Restore of our tasks
+#if (MyRTOS_Context_Switch_Benchmark == 1)
+	//R12 = DWT Cycle Counter at the start (R12 is saved by the CPU so we can use it)
+	__asm volatile("LDR R1, =0xE0001004 \n\t"
+			"LDR R12, [R1]");
+#endif
 
 	/*
 	 * ----------------------------------------
 	 * | Save The Context of the current task |
 	 * ----------------------------------------
-	 */
-
-	/*
 	 * 1. Get the Current_PSP from CPU registers
+	 * 2. Push the registers from R4 to R11 and CONTROL (privileged or not) under it
+	 * 3. Save the new PSP in Current_Task->Current_PSP_Task
 	 * |-------|
 	 * |  xPSR |
 	 * |  PC   |
@@ -153,151 +307,84 @@ __attribute ((naked)) void PendSV_Handler(void)
 	 * |  R3   |
 	 * |  R2   |
 	 * |  R1   |
-	 * |  R0   |	<-- Current PSP
-	 * |-------|
-	 */
-	OS_Get_PSP_Val(OS_Control_t.Current_Task->Current_PSP_Task);
-
-	/*
-	 * 2. Save the registers from R4 to R11
+	 * |  R0   |	<-- PSP
 	 * |-------|
-	 * |  R4   |
-	 * |  R5   |
-	 * |  R6   |
-	 * |  R7   |
-	 * |  R8   |
-	 * |  R9   |
-	 * |  R10  |
 	 * |  R11  |
-	 * |-------|
-	 */
-	OS_Control_t.Current_Task->Current_PSP_Task--;
-	__asm volatile ("MOV %[OUT], R4" : [OUT] "=r" ((*OS_Control_t.Current_Task->Current_PSP_Task))); //R4
-
-	OS_Control_t.Current_Task->Current_PSP_Task--;
-	__asm volatile ("MOV %[OUT], R5" : [OUT] "=r" ((*OS_Control_t.Current_Task->Current_PSP_Task))); //R5
-
-	OS_Control_t.Current_Task->Current_PSP_Task--;
-	__asm volatile ("MOV %[OUT], R6" : [OUT] "=r" ((*OS_Control_t.Current_Task->Current_PSP_Task))); //R6
-
-	OS_Control_t.Current_Task->Current_PSP_Task--;
-	__asm volatile ("MOV %[OUT], R7" : [OUT] "=r" ((*OS_Control_t.Current_Task->Current_PSP_Task))); //R7
-
-	OS_Control_t.Current_Task->Current_PSP_Task--;
-	__asm volatile ("MOV %[OUT], R8" : [OUT] "=r" ((*OS_Control_t.Current_Task->Current_PSP_Task))); //R8
-
-	OS_Control_t.Current_Task->Current_PSP_Task--;
-	__asm volatile ("MOV %[OUT], R9" : [OUT] "=r" ((*OS_Control_t.Current_Task->Current_PSP_Task))); //R9
-
-	OS_Control_t.Current_Task->Current_PSP_Task--;
-	__asm volatile ("MOV %[OUT], R10" : [OUT] "=r" ((*OS_Control_t.Current_Task->Current_PSP_Task))); //R10
-
-	OS_Control_t.Current_Task->Current_PSP_Task--;
-	__asm volatile ("MOV %[OUT], R11" : [OUT] "=r" ((*OS_Control_t.Current_Task->Current_PSP_Task))); //R11
-
-	/*
-	 * 3. Save the Current Value of PSP --> it Saved in Current_PSP_Task
-	 * |-------|
-	 * |  R4   |
-	 * |  R5   |
-	 * |  R6   |
-	 * |  R7   |
-	 * |  R8   |
-	 * |  R9   |
 	 * |  R10  |
-	 * |  R11  |		<-- Current_PSP_Task
+	 * |  R9   |
+	 * |  R8   |
+	 * |  R7   |
+	 * |  R6   |
+	 * |  R5   |
+	 * |  R4   |
+	 * |CONTROL|	<-- Current_PSP_Task
 	 * |-------|
 	 */
+	__asm volatile("MRS R0, PSP \n\t"
+			"MRS R1, CONTROL \n\t"
+			"STMDB R0!, {R1, R4-R11} \n\t"
+			"LDR R3, =OS_Control_t \n\t"		//R3 = &OS_Control_t
+			"LDR R2, [R3] \n\t"				//R2 = OS_Control_t.Current_Task
+			"STR R0, [R2]");					//OS_Control_t.Current_Task->Current_PSP_Task = R0
 
 	/*
-	 * -----------------------------------------------------------------------------------------------
-	 * |=============================================================================================|
-	 * -----------------------------------------------------------------------------------------------
+	 * -------------------------------------------------------------------------------------
+	 * | Current_Task = Next_Task (BASEPRI = max syscall priority --> SVC & the interrupts |
+	 * | that use the OS APIs can't interrupt us but the higher priorities are not masked) |
+	 * | the switch is counted here only when the task is really changed                   |
+	 * -------------------------------------------------------------------------------------
 	 */
-
-
+	__asm volatile("LDR R0, =OS_Syscall_BASEPRI \n\t"
+			"LDR R0, [R0] \n\t"
+			"MSR BASEPRI, R0 \n\t"
+			"LDR R1, [R3, #4] \n\t"			//R1 = OS_Control_t.Next_Task
+			"CBZ R1, 1f \n\t"
+			"CMP R1, R2 \n\t"
+			"BEQ 2f \n\t"
+			"STR R1, [R3] \n\t"				//OS_Control_t.Current_Task = Next_Task
+			"LDR R0, [R3, #8] \n\t"
+			"ADDS R0, R0, #1 \n\t"
+			"STR R0, [R3, #8] \n\t"			//OS_Control_t.Context_Switch_Count++
+			"2: \n\t"
+			"MOVS R2, #0 \n\t"
+			"STR R2, [R3, #4] \n\t"			//OS_Control_t.Next_Task = NULL
+			"MOV R2, R1 \n\t"
+			"1: \n\t"
+			"MOVS R0, #0 \n\t"
+			"MSR BASEPRI, R0");
 
 	/*
 	 * ----------------------------------------
 	 * | Restore The Context of the Next task |
 	 * ----------------------------------------
+	 * 1. Pop CONTROL and R4 to R11 from Current_Task->Current_PSP_Task
+	 * 2. Set CONTROL (the next task may be privileged or not) & PSP with the address after them
+	 * 3. The other registers will restored automatically by CPU when we return
 	 */
-	if(OS_Control_t.Next_Task != NULL)
-	{
-		OS_Control_t.Current_Task = OS_Control_t.Next_Task;
-		OS_Control_t.Next_Task = NULL;
-	}
-
-	/*
-	 * 1. Write the values of registers from memory to CPU registers
-	 * |-------|
-	 * |  R4   |
-	 * |  R5   |
-	 * |  R6   |
-	 * |  R7   |
-	 * |  R8   |
-	 * |  R9   |
-	 * |  R10  |
-	 * |  R11  |		<-- Current_PSP_Task
-	 * |-------|
-	 */
-	__asm volatile ("MOV R11, %[IN]" : : [IN] "r" ((*OS_Control_t.Current_Task->Current_PSP_Task))); //R11
-	OS_Control_t.Current_Task->Current_PSP_Task++;
-
-	__asm volatile ("MOV R10, %[IN]" : : [IN] "r" ((*OS_Control_t.Current_Task->Current_PSP_Task))); //R10
-	OS_Control_t.Current_Task->Current_PSP_Task++;
-
-	__asm volatile ("MOV R9, %[IN]" : : [IN] "r" ((*OS_Control_t.Current_Task->Current_PSP_Task))); //R9
-	OS_Control_t.Current_Task->Current_PSP_Task++;
-
-	__asm volatile ("MOV R8, %[IN]" : : [IN] "r" ((*OS_Control_t.Current_Task->Current_PSP_Task))); //R8
-	OS_Control_t.Current_Task->Current_PSP_Task++;
-
-	__asm volatile ("MOV R7, %[IN]" : : [IN] "r" ((*OS_Control_t.Current_Task->Current_PSP_Task))); //R7
-	OS_Control_t.Current_Task->Current_PSP_Task++;
-
-	__asm volatile ("MOV R6, %[IN]" : : [IN] "r" ((*OS_Control_t.Current_Task->Current_PSP_Task))); //R6
-	OS_Control_t.Current_Task->Current_PSP_Task++;
-
-	__asm volatile ("MOV R5, %[IN]" : : [IN] "r" ((*OS_Control_t.Current_Task->Current_PSP_Task))); //R5
-	OS_Control_t.Current_Task->Current_PSP_Task++;
-
-	__asm volatile ("MOV R4, %[IN]" : : [IN] "r" ((*OS_Control_t.Current_Task->Current_PSP_Task))); //R4
-	OS_Control_t.Current_Task->Current_PSP_Task++;
-
-	/*
-	 * 2.Set PSP with Current_PSP_Task
-	 */
-	OS_Set_PSP_Val(OS_Control_t.Current_Task->Current_PSP_Task);
-
-	/*
-	 * 3.The other registers will restored automatically by CPU
-	 * |-------| |-----------------------------|
-	 * |  xPSR | |*****************************|
-	 * |  PC   | |*****************************|
-	 * |  LR   | |*****************************|
-	 * |  R12  | |<CPU read them automatically>|
-	 * |  R3   | |*****************************|
-	 * |  R2   | |*****************************|
-	 * |  R1   | |*****************************|
-	 * |  R0   |	<-- Current PSP		<-- PSP
-	 * |-------| |-----------------------------|
-	 * |  R4   | |*****************************|
-	 * |  R5   | |*****************************|
-	 * |  R6   | |*****************************|
-	 * |  R7   | |***<we read them manually>***|
-	 * |  R8   | |*****************************|
-	 * |  R9   | |*****************************|
-	 * |  R10  | |*****************************|
-	 * |  R11  | |*****************************|
-	 * |-------| |-----------------------------|
-	 */
+	__asm volatile("LDR R0, [R2] \n\t"				//R0 = OS_Control_t.Current_Task->Current_PSP_Task
+			"LDMIA R0!, {R1, R4-R11} \n\t"
+			"MSR CONTROL, R1 \n\t"
+			"MSR PSP, R0");
+
+#if (MyRTOS_Context_Switch_Benchmark == 1)
+	//Cycles = DWT Cycle Counter - R12 --> save the last and the max values
+	__asm volatile("LDR R1, =0xE0001004 \n\t"
+			"LDR R1, [R1] \n\t"
+			"SUB R1, R1, R12 \n\t"
+			"LDR R2, =OS_Context_Switch_Benchmark \n\t"
+			"STR R1, [R2] \n\t"
+			"LDR R3, [R2, #4] \n\t"
+			"CMP R1, R3 \n\t"
+			"IT HI \n\t"
+			"STRHI R1, [R2, #4]");
+#endif
 
 	/*
-	 * 4. Branch to LR to return from Interrupt handler
+	 * Branch to LR to return from Interrupt handler
 	 * LR --> contain EXC_RETURN Code
 	 */
-	__asm("BX LR");
+	__asm volatile("BX LR \n\t"
+			".ltorg");
 }
 
 /*
@@ -327,10 +414,91 @@ void IDLE_TASK_FUNC(void)
 	while(1)
 	{
 		IDLE_Task_Led ^= 1;
+
+#if (MyRTOS_Tickless_Idle_Enable == 1)
+		//ask the OS to stop the periodic ticks till the next task wakes up
+		OS_Call(SVC_Tickless_Idle, 0, 0, 0, 0);
+#endif
+
 		__asm("WFE");
 	}
 }
 
+/*
+ * Function Name : OS_Tickless_Idle_Enter
+ * Function [IN] : none
+ * Function [OUT]: none
+ * Usage         : it's used by the IDLE Task (through SVC) to suppress the periodic ticks
+ *                 when only the IDLE Task is ready --> the next SysTick interrupt comes
+ *                 when the first task in the delayed list should wake up
+ */
+void OS_Tickless_Idle_Enter(void)
+{
+#if (MyRTOS_Tickless_Idle_Enable == 1)
+	unsigned int Expected_Idle_Ticks;
+
+	//the ticks are suppressed already
+	if(OS_Control_t.Suppressed_Ticks != 0)
+		return;
+
+	//there is another ready task or the tick interrupt is pending now
+	if(Ready_Lists[MyRTOS_IDLE_Task_Priority].Count != 1 || Ready_Priority_Bitmap != Priority_Bitmap_Mask(MyRTOS_IDLE_Task_Priority))
+		return;
+	if(SCB->ICSR & SCB_ICSR_PENDSTSET_Msk)
+		return;
+
+	if(List_Is_Empty(&Delayed_List))
+		Expected_Idle_Ticks = OS_Ticker_Max_Suppressed_Ticks;
+	else
+		Expected_Idle_Ticks = Delayed_List.Head->Item_Value;
+
+	if(Expected_Idle_Ticks < MyRTOS_Tickless_Min_Idle_Ticks)
+		return;
+
+	OS_Control_t.Suppressed_Ticks = OS_Ticker_Suppress(Expected_Idle_Ticks);
+#endif
+}
+
+/*
+ * Function Name : OS_Tickless_Idle_Exit
+ * Function [IN] : none
+ * Function [OUT]: none
+ * Usage         : it's used when the CPU wakes up from tickless idle (SysTick or any OS service)
+ *                 to return to periodic ticks and correct the tick count and the delayed list
+ *                 with the ticks that passed while the CPU was sleeping
+ */
+void OS_Tickless_Idle_Exit(void)
+{
+#if (MyRTOS_Tickless_Idle_Enable == 1)
+	unsigned int Elapsed_Ticks;
+
+	if(OS_Control_t.Suppressed_Ticks == 0)
+		return;
+
+	//it's always less than the delta of the delayed list head so no task wakes up here
+	Elapsed_Ticks = OS_Ticker_Resume(OS_Control_t.Suppressed_Ticks);
+	OS_Control_t.Suppressed_Ticks = 0;
+
+	OS_Control_t.Tick_Count += Elapsed_Ticks;
+
+	if(!List_Is_Empty(&Delayed_List))
+		Delayed_List.Head->Item_Value -= Elapsed_Ticks;
+#endif
+}
+
+/*
+ * Function Name : OS_Get_Timestamp
+ * Function [IN] : none
+ * Function [OUT]: it's return the number of SysTick counts since the OS is started
+ * Usage         : it's called by the timestamp service (OS_Kernel_Service) so the ticks suppressed by
+ *                 tickless idle are already added and the SysTick interrupt can't change the tick count
+ *                 between reading it and reading the counter
+ */
+unsigned long long OS_Get_Timestamp(void)
+{
+	return (OS_Control_t.Tick_Count * OS_Ticker_Counts_Per_Tick) + OS_Ticker_Elapsed_Counts();
+}
+
 /*
  * Function Name : MYRTOS_init
  * Function [IN] : none
@@ -340,6 +508,7 @@ void IDLE_TASK_FUNC(void)
 MYRTOS_ES_t MYRTOS_init(void)
 {
 	MYRTOS_ES_t Local_enuErrorState = ES_NoError;
+	unsigned int i;
 
 	//Updata OS Mode --> OS_Suspend
 	OS_Control_t.OS_State = OS_Suspend;
@@ -347,15 +516,23 @@ MYRTOS_ES_t MYRTOS_init(void)
 	//Specify the Main Stack for OS
 	MyRTOS_Create_MainStack();
 
-	//Create OS Ready Queue
-	if(FIFO_init(&Ready_Queue, Ready_Queue_FIFO, Max_Num_of_Tasks) != FIFO_no_error)
+	//Create OS Ready Lists (one for each priority level) with the default time slice
+	for(i = 0; i < MyRTOS_Num_of_Priorities; i++)
 	{
-		Local_enuErrorState = ES_Ready_Queue_Init_Error;
+		List_Init(&Ready_Lists[i]);
+		Time_Slice_Ticks[i] = MyRTOS_Default_Time_Slice_Ticks;
 	}
 
+	//No Round Robin in EDF band --> the earliest deadline runs till it blocks or is preempted
+	Time_Slice_Ticks[MyRTOS_EDF_Band_Priority] = 0;
+	Ready_Priority_Bitmap = 0;
+
+	//Create OS Delayed List
+	List_Init(&Delayed_List);
+
 	//Configure IDLE Task
 	strcpy(MyRTOS_IDLE_TASK.Task_Name, "Idle_Task");
-	MyRTOS_IDLE_TASK.Task_Priority = 255;
+	MyRTOS_IDLE_TASK.Task_Priority = MyRTOS_IDLE_Task_Priority;
 	MyRTOS_IDLE_TASK.PF_Task_Entry = IDLE_TASK_FUNC;
 	MyRTOS_IDLE_TASK.Task_Stack_Size = 300;
 
@@ -364,6 +541,22 @@ MYRTOS_ES_t MYRTOS_init(void)
 	return Local_enuErrorState;
 }
 
+/*
+ * Function Name : MyRTOS_Task_Exit
+ * Function [IN] : none
+ * Function [OUT]: none
+ * Usage         : it's the return address (LR) of each task function
+ *                 if the task function returns by mistake the task is terminated
+ */
+void MyRTOS_Task_Exit(void)
+{
+	MyRTOS_Terminate_Task(OS_Control_t.Current_Task);
+
+	while(1)
+	{
+	}
+}
+
 /*
  * Function Name : MyRTOS_Create_Task_Stack
  * Function [IN] : it takes a pointer to task that we need to create a task for it
@@ -388,38 +581,42 @@ void MyRTOS_Create_Task_Stack(Task_Ref_t *Task_Ref_CFG)
 	 * |  R0   |
 	 * |-------|
 	 * ----------------------------------------------
-	 * |This Part is saved/restored by us (manually)|
+	 * |This Part is saved/restored by us (STMDB/LDMIA in PendSV_Handler)|
 	 * ----------------------------------------------
 	 * |-------|
-	 * |  R4   |
-	 * |  R5   |
-	 * |  R6   |
-	 * |  R7   |
-	 * |  R8   |
-	 * |  R9   |
-	 * |  R10  |
 	 * |  R11  |
+	 * |  R10  |
+	 * |  R9   |
+	 * |  R8   |
+	 * |  R7   |
+	 * |  R6   |
+	 * |  R5   |
+	 * |  R4   |
+	 * |CONTROL|	<-- Current_PSP_Task
 	 * |-------|
 	 */
 
 	Task_Ref_CFG->Current_PSP_Task = (unsigned int *)(Task_Ref_CFG->_S_PSP_Task);
 
 	Task_Ref_CFG->Current_PSP_Task--;
-	*(Task_Ref_CFG->Current_PSP_Task) = 0x01000000;	//DUMMY xPSR --> you must put T = 1 to avoid Bus Fault (Thumb2 Technology)
+	*(Task_Ref_CFG->Current_PSP_Task) = 0x01000000;	//xPSR --> you must put T = 1 to avoid Usage Fault (Thumb2 Technology)
 
 	Task_Ref_CFG->Current_PSP_Task--;
-	*(Task_Ref_CFG->Current_PSP_Task) = (unsigned int)(Task_Ref_CFG->PF_Task_Entry);	//DUMMY PC
+	*(Task_Ref_CFG->Current_PSP_Task) = ((unsigned int)(Task_Ref_CFG->PF_Task_Entry)) & ~0x1UL;	//PC --> Task Entry (bit0 must be 0 in the stack frame)
 
 	Task_Ref_CFG->Current_PSP_Task--;
-	*(Task_Ref_CFG->Current_PSP_Task) = 0xFFFFFFFD;	//DUMMY LR --> (EXECUTION RETURN CODE --> Thread Mode, PSP)
+	*(Task_Ref_CFG->Current_PSP_Task) = (unsigned int)(MyRTOS_Task_Exit);	//LR --> if the task function returns it goes to MyRTOS_Task_Exit
 
-	//Still 13 General Purpose Register --> We dummy them to 0
+	//R12, R3, R2, R1, R0 then R11 to R4 --> We dummy them to 0
 	for(int i = 0; i < 13; i++)
 	{
 		Task_Ref_CFG->Current_PSP_Task--;
 		*(Task_Ref_CFG->Current_PSP_Task) = 0;
 	}
 
+	//CONTROL --> SPSEL = 1 (PSP) & nPRIV = 1 if the task is unprivileged
+	Task_Ref_CFG->Current_PSP_Task--;
+	*(Task_Ref_CFG->Current_PSP_Task) = (Task_Ref_CFG->Task_Privileged) ? 0x2 : 0x3;
 }
 
 /*
@@ -462,646 +659,2336 @@ MYRTOS_ES_t MyRTOS_Create_Task(Task_Ref_t *Task_Ref_Config)
 	 * -------------
 	 */
 
+	//EDF tasks take the priority of the EDF band
+	if(Task_Ref_Config->Task_Scheduling_Class == EDF_Class)
+		Task_Ref_Config->Task_Priority = MyRTOS_EDF_Band_Priority;
+
+	// Check if task priority has a ready list or not
+	if(Task_Ref_Config->Task_Priority >= MyRTOS_Num_of_Priorities)
+	{
+		Local_enuErrorState = ES_Error_Invalid_Priority;
+	}
 	// Check if task stack size exceeded the PSP stack size
-	if(((OS_Control_t.PSP_Task_Locator - Task_Ref_Config->Task_Stack_Size) < (unsigned int)(&_eheap)))
+	else if(((OS_Control_t.PSP_Task_Locator - Task_Ref_Config->Task_Stack_Size) < (unsigned int)(&_eheap)))
 	{
 		Local_enuErrorState = ES_Error_Task_Exceeded_Stack_Size;
 	}
-
-	if(Local_enuErrorState == ES_NoError)
+	// Check if the scheduler table has a place for the task or not
+	else if(OS_Control_t.No_of_Active_Tasks >= Max_Num_of_Tasks)
 	{
-		//Create Its Own PSP Stack
-		Task_Ref_Config->_S_PSP_Task = OS_Control_t.PSP_Task_Locator;
+		Local_enuErrorState = ES_Error_Task_Table_Full;
+	}
+	else
+	{
+		//Create Its Own PSP Stack (Aligned 8 bytes as the stack frame needs)
+		Task_Ref_Config->_S_PSP_Task = OS_Control_t.PSP_Task_Locator & ~0x7UL;
 		Task_Ref_Config->_E_PSP_Task = (Task_Ref_Config->_S_PSP_Task - Task_Ref_Config->Task_Stack_Size);
 
 		//Aligned 8 bytes spaces between PSP (Task) and PSP (Other Task)
 		OS_Control_t.PSP_Task_Locator = (Task_Ref_Config->_E_PSP_Task - 8);
-	}
 
-	//Initialize PSP Task Stack
-	MyRTOS_Create_Task_Stack(Task_Ref_Config);
+		//Initialize PSP Task Stack
+		MyRTOS_Create_Task_Stack(Task_Ref_Config);
 
-	//Task State Update --> Suspend State
-	Task_Ref_Config->Task_State = Suspend_State;
+		//Task State Update --> Suspend State
+		Task_Ref_Config->Task_State = Suspend_State;
+
+		//Task is not linked to any ready list till we activate it
+		List_Node_Init(&Task_Ref_Config->Task_State_Node, Task_Ref_Config);
+		Task_Ref_Config->Task_State_Node.Item_Value = Task_Ref_Config->Task_Priority;
+
+		//Task doesn't wait for any mutex and doesn't hold any mutex (no inherited priority)
+		List_Node_Init(&Task_Ref_Config->Task_Event_Node, Task_Ref_Config);
+		Task_Ref_Config->Task_Waiting_Mutex = NULL;
+		List_Init(&Task_Ref_Config->Task_Held_Mutexes);
+		Task_Ref_Config->Task_Base_Priority = Task_Ref_Config->Task_Priority;
+
+		//Task has no notification
+		Task_Ref_Config->Task_Notify_Value = 0;
+		Task_Ref_Config->Task_Notify_State = Notify_Not_Waiting;
 
-	//Add Task to Scheduler Table
-	OS_Control_t.OS_Tasks[OS_Control_t.No_of_Active_Tasks++] = Task_Ref_Config;
+		//Add Task to Scheduler Table
+		OS_Control_t.OS_Tasks[OS_Control_t.No_of_Active_Tasks++] = Task_Ref_Config;
+	}
 
+	//a task with an error isn't created (no stack and no place in the table) so it can't be activated
 	return Local_enuErrorState;
 }
 
 /*
- * Enumeration Name: SVC_ID_t
- * Usage:          : it has all cases of SVC IDs
+ * Function Name : MyRTOS_Ready_List_Add
+ * Function [IN] : it takes a pointer to the task that become ready
+ * Function [OUT]: none
+ * Usage         : it's used to add the task at the tail of the ready list of its priority
+ *                 and mark this priority in the bitmap --> O(1)
+ *                 EDF tasks are added to the EDF band in the order of their absolute deadlines
+ *                 (a fixed priority task which inherits the priority of the band is due now)
  */
-typedef enum
+void MyRTOS_Ready_List_Add(Task_Ref_t *Task_Ref_Config)
 {
-	SVC_Activate_Task = 1,
-	SVC_Terminate_Task,
-	SVC_Task_Waiting_Time,
-	SVC_Acquire_Mutex,
-	SVC_Release_Mutex
-}SVC_ID_t;
+	unsigned char Priority = Task_Ref_Config->Task_Priority;
+
+	//EDF band is ordered by the absolute deadline (same deadline --> FIFO) not by the arrive time
+	if(Priority == MyRTOS_EDF_Band_Priority)
+	{
+		if(Task_Ref_Config->Task_Scheduling_Class == EDF_Class)
+			Task_Ref_Config->Task_State_Node.Item_Value = Task_Ref_Config->Task_Absolute_Deadline;
+		else
+			Task_Ref_Config->Task_State_Node.Item_Value = (unsigned int)OS_Control_t.Tick_Count;
+
+		List_Insert_Ordered(&Ready_Lists[Priority], &Task_Ref_Config->Task_State_Node);
+	}
+	else
+	{
+		List_Insert_Tail(&Ready_Lists[Priority], &Task_Ref_Config->Task_State_Node);
+	}
+	Ready_Priority_Bitmap |= Priority_Bitmap_Mask(Priority);
+
+	Task_Ref_Config->Task_State = Ready_State;
+}
 
 /*
- * Function Name : Bubble_Sort_Tasks
- * Function [IN] : none
+ * Function Name : MyRTOS_Ready_List_Remove
+ * Function [IN] : it takes a pointer to the task that leave the ready state
  * Function [OUT]: none
- * Usage         : it's used to sort the tasks on scheduler table based on the priority of each task
+ * Usage         : it's used to remove the task from the ready list of its priority
+ *                 and clear this priority from the bitmap if its list becomes empty --> O(1)
  */
-void Bubble_Sort_Tasks(void)
+void MyRTOS_Ready_List_Remove(Task_Ref_t *Task_Ref_Config)
 {
-	unsigned int i, j, Num_Tasks;
-	Task_Ref_t *Temp;
+	unsigned char Priority = Task_Ref_Config->Task_Priority;
 
-	Num_Tasks = OS_Control_t.No_of_Active_Tasks;
+	List_Remove(&Task_Ref_Config->Task_State_Node);
 
-	for(i = 0; i < Num_Tasks; i++)
-	{
-		for(j = 0; j < Num_Tasks - i - 1; j++)
-		{
-			if(OS_Control_t.OS_Tasks[j]->Task_Priority > OS_Control_t.OS_Tasks[j+1]->Task_Priority)
-			{
-				Temp = OS_Control_t.OS_Tasks[j];
-				OS_Control_t.OS_Tasks[j] = OS_Control_t.OS_Tasks[j+1];
-				OS_Control_t.OS_Tasks[j+1] = Temp;
-			}
-		}
-	}
-}
+	if(List_Is_Empty(&Ready_Lists[Priority]))
+		Ready_Priority_Bitmap &= ~Priority_Bitmap_Mask(Priority);
 
+	Task_Ref_Config->Task_State = Suspend_State;
+}
 
 /*
- * Function Name : MyRTOS_Update_Scheduler_Tabel
- * Function [IN] : none
- * Function [OUT]: it's return the error state of function to check with it if any error happens
- * Usage         : it's used to update scheduler table and rearrange the tasks in the table
+ * Function Name : OS_Delayed_List_Insert
+ * Function [IN] : it takes a pointer to the task and the number of ticks that it will wait
+ * Function [OUT]: none
+ * Usage         : it's used to insert the task in the delta list at the position of its wake-up time
+ *                 the ticks of the tasks before it are subtracted so the node keeps only its delta
+ *
+ *                 Example: Tasks wake up after 3, 5, 5, 9 ticks
+ *                 -------     -------     -------     -------
+ *                 |  3  | --> |  2  | --> |  0  | --> |  4  |
+ *                 -------     -------     -------     -------
  */
-MYRTOS_ES_t MyRTOS_Update_Scheduler_Tabel(void)
+void OS_Delayed_List_Insert(Task_Ref_t *Task_Ref_Config, unsigned int No_Ticks)
 {
-	MYRTOS_ES_t Local_enuErrorState = ES_NoError;
+	List_Node_t *P_Iterator = Delayed_List.Head;
+
+	//skip the tasks which wake up before or with this task
+	while(P_Iterator != NULL && No_Ticks >= P_Iterator->Item_Value)
+	{
+		No_Ticks -= P_Iterator->Item_Value;
+		P_Iterator = P_Iterator->Next;
+	}
 
-	//Sort Scheduler Table (OS_Control --> Tasks[100]) --> with Bubble Sort
-	//Base on Priority --> (high priority(low number) then low priority(high number))
-	Bubble_Sort_Tasks();
+	Task_Ref_Config->Task_State_Node.Item_Value = No_Ticks;
+	List_Insert_Before(&Delayed_List, P_Iterator, &Task_Ref_Config->Task_State_Node);
 
-	return Local_enuErrorState;
+	//the task after it will wake up relative to this task now
+	if(P_Iterator != NULL)
+		P_Iterator->Item_Value -= No_Ticks;
 }
 
 /*
- * Function Name : MyRTOS_Update_Ready_Queue
- * Function [IN] : none
- * Function [OUT]: it's return the error state of function to check with it if any error happens
- * Usage         : it's used to update ready queue and add to it the tasks that should be in ready state
+ * Function Name : OS_Delayed_List_Remove
+ * Function [IN] : it takes a pointer to the task
+ * Function [OUT]: none
+ * Usage         : it's used to remove the task from the delta list before its time is finished
+ *                 its ticks are given to the task after it so this task wakes up at the same time
  */
-MYRTOS_ES_t MyRTOS_Update_Ready_Queue(void)
+void OS_Delayed_List_Remove(Task_Ref_t *Task_Ref_Config)
 {
-	MYRTOS_ES_t Local_enuErrorState = ES_NoError;
+	List_Node_t *P_Node = &Task_Ref_Config->Task_State_Node;
 
-	Task_Ref_t *Top_Ready_Queue = NULL;
-	unsigned int i = 0;
-
-	Task_Ref_t *P_Curr_Task = NULL;
-	Task_Ref_t *P_Next_Task = NULL;
-
-	//Free Ready Queue
-	while(FIFO_Dequeue_Item(&Ready_Queue, &Top_Ready_Queue) != FIFO_empty);
-
-	//Update Ready Queue
-	while(i < OS_Control_t.No_of_Active_Tasks)
-	{
-		P_Curr_Task = OS_Control_t.OS_Tasks[i];
-		P_Next_Task = OS_Control_t.OS_Tasks[i+1];
-
-		/*
-		 * ------------------
-		 * |Scheduler Table:|
-		 * ------------------
-		 *
-		 * |----------|----------|
-		 * | Task1 (1)|  suspend |
-		 * |----------|----------|
-		 * | Task2 (2)|  waiting |
-		 * |----------|----------|
-		 * | Task3 (2)|  waiting |
-		 * |----------|----------|
-		 * | Task4 (3)|  waiting |
-		 * |----------|----------|
-		 * |    0     |    0     |
-		 * |----------|----------|
-		 * |    0     |    0     |
-		 * |----------|----------|
-		 */
-
-		//we are care now with tasks that are in waiting state not suspend state
-		if(P_Curr_Task->Task_State != Suspend_State)
-		{
-			//This if we reach to the end of the scheduler table
-			if(P_Next_Task->Task_State == Suspend_State)
-			{
-				FIFO_Enqueue_Item(&Ready_Queue, P_Curr_Task);
-				P_Curr_Task->Task_State = Ready_State;
-				break;
-			}
-
-			if(P_Curr_Task->Task_Priority < P_Next_Task->Task_Priority)
-			{
-				//This if the next task is low priority from the current then we push current to ready queue
-				FIFO_Enqueue_Item(&Ready_Queue, P_Curr_Task);
-				P_Curr_Task->Task_State = Ready_State;
-				break;
-			}
-			else if(P_Curr_Task->Task_Priority == P_Next_Task->Task_Priority)
-			{
-				//This if the next task is equal the current task in priority then we push current to ready queue
-				//and we will continue to the relation of next task with its next
-				FIFO_Enqueue_Item(&Ready_Queue, P_Curr_Task);
-				P_Curr_Task->Task_State = Ready_State;
-			}
-			else if(P_Curr_Task->Task_Priority > P_Next_Task->Task_Priority)
-			{
-				//This can't happen because we sort the scheduler table with bubble sort
-				Local_enuErrorState = ES_Error_Bubble_Sort;
-			}
-		}
+	if(P_Node->Next != NULL)
+		P_Node->Next->Item_Value += P_Node->Item_Value;
 
-		i++;
-	}
+	List_Remove(P_Node);
 
-	return Local_enuErrorState;
+	Task_Ref_Config->Task_Timing_Waiting.Task_Blocking = Blocking_Disable;
 }
 
 /*
- * Function Name : OS_Decide_What_Next
- * Function [IN] : none
+ * Function Name : OS_Release_Job
+ * Function [IN] : it takes a pointer to the task (it isn't in any list)
  * Function [OUT]: none
- * Usage         : it's used to decide which task that should run next the current task
+ * Usage         : it's used to release a new job of the task at its Task_Wake_Tick
+ *                 the deadline of an EDF job is counted from this tick (not from the time it wakes up)
+ *                 --> periodic release: it's the release tick so a late wake up doesn't move the deadlines
+ *                 --> end of a relative wait: it's the wake-up tick (the release tick is an old anchor)
  */
-void OS_Decide_What_Next(void)
+void OS_Release_Job(Task_Ref_t *Task_Ref_Config)
 {
-	//This in case The Queue is empty and OS_Control_t.Current_Task->Task_State != Suspend_State
-	//This happen when we have only one task and this task is interrupting by svc
-	//we need to continue in running it
-	if(Ready_Queue.count == 0 && OS_Control_t.Current_Task->Task_State != Suspend_State)
-	{
-		OS_Control_t.Current_Task->Task_State = Running_State;
+	if(Task_Ref_Config->Task_Scheduling_Class == EDF_Class)
+		Task_Ref_Config->Task_Absolute_Deadline = Task_Ref_Config->Task_Wake_Tick + Task_Ref_Config->Task_Relative_Deadline;
+
+	MyRTOS_Ready_List_Add(Task_Ref_Config);
+}
+
+/*
+ * Function Name : OS_Task_Wait_Release
+ * Function [IN] : it takes a pointer to the task (its Task_Release_Tick is filled) and the ticks till its release
+ * Function [OUT]: none
+ * Usage         : it's used to make the task wait in the delayed list till its release tick
+ *                 if the release tick is now (No_Ticks = 0) the new job is released now
+ */
+void OS_Task_Wait_Release(Task_Ref_t *Task_Ref_Config, unsigned int No_Ticks)
+{
+	Task_Ref_Config->Task_Wake_Tick = Task_Ref_Config->Task_Release_Tick;
 
-		//add Task to Ready Queue to run it till the task is terminate
-		FIFO_Enqueue_Item(&Ready_Queue, OS_Control_t.Current_Task);
-		OS_Control_t.Next_Task = OS_Control_t.Current_Task;
+	MyRTOS_Ready_List_Remove(Task_Ref_Config);
+
+	if(No_Ticks > 0)
+	{
+		Task_Ref_Config->Task_Timing_Waiting.Task_Blocking = Blocking_Enable;
+		OS_Delayed_List_Insert(Task_Ref_Config, No_Ticks);
 	}
 	else
 	{
-		//dequeue the top of ready queue because this is should running next
-		FIFO_Dequeue_Item(&Ready_Queue, &OS_Control_t.Next_Task);
-		OS_Control_t.Next_Task->Task_State = Running_State;
-
-		//check if the next task priority is equal the current task priority to work with Round Robin Algorithm
-		//check if the user doesn't terminate the current task so we will run it
-		if((OS_Control_t.Current_Task->Task_Priority == OS_Control_t.Next_Task->Task_Priority) && (OS_Control_t.Current_Task->Task_State != Suspend_State))
-		{
-			//enqueue the current task in the Ready Queue so that the other task will be on top and current will be after it
-			//we do this because we run with Round Robin Algorithm
-			FIFO_Enqueue_Item(&Ready_Queue, OS_Control_t.Current_Task);
-			OS_Control_t.Current_Task->Task_State = Ready_State;
-		}
+		OS_Release_Job(Task_Ref_Config);
 	}
 }
 
 /*
- * Function Name : OS_SVC_Services
- * Function [IN] : it tasks a pointer to the start address memory after we do switch context
- *                 we will use it to get SVC ID and we take it from R0
- * Function [OUT]: it's return the error state of function to check with it if any error happens
- * Usage         : it's used to determine the SVC ID then call the SVC handler with correct id
+ * Function Name : OS_First_Release_Tick
+ * Function [IN] : it takes a pointer to the task
+ * Function [OUT]: it's return the tick of the first job of the task after its activation (64-bit)
+ * Usage         : a periodic task is released at (Task_Offset + k * Task_Period) ticks from the start
+ *                 of the OS so its phase doesn't depend on the time we activate it
+ *                 other tasks are released at the tick of the activation
+ *                 --> it's counted from the 64-bit tick count so the phase is kept after the 32-bit wrap
+ *                     and the release tick is never more than Task_Period (or Task_Offset) after now
  */
-MYRTOS_ES_t OS_SVC_Services(unsigned int *Stack_Frame_Pointer)
+unsigned long long OS_First_Release_Tick(Task_Ref_t *Task_Ref_Config)
 {
-	MYRTOS_ES_t Local_enuErrorState = ES_NoError;
-
-	unsigned char SVC_ID;
-	SVC_ID = *((unsigned char *)(((unsigned char *)Stack_Frame_Pointer[6])-2));
+	unsigned long long Release_Tick = OS_Control_t.Tick_Count;
+	unsigned long long Periods;
 
-	switch(SVC_ID)
+	if(Task_Ref_Config->Task_Period != 0)
 	{
-	case SVC_Activate_Task:
-	case SVC_Terminate_Task:
-		//Update Scheduler Table
-		Local_enuErrorState = MyRTOS_Update_Scheduler_Tabel();
-		if(Local_enuErrorState != ES_NoError)
-			while(1);
-
-		//Update Ready Queue
-		Local_enuErrorState = MyRTOS_Update_Ready_Queue();
-		if(Local_enuErrorState != ES_NoError)
-			while(1);
-
-		//OS is in Running State or not
-		if(OS_Control_t.OS_State == OS_Running)
+		if(Task_Ref_Config->Task_Offset >= Release_Tick)
 		{
-			if(strcmp(OS_Control_t.Current_Task->Task_Name, "Idle_Task") != 0)
-			{
-				//Decide What task should run Next
-				OS_Decide_What_Next();
-
-				//Trigger OS_PendSV (Switch Context/Restore for our Tasks)
-				Trigger_OS_PendSV();
-			}
+			Release_Tick = Task_Ref_Config->Task_Offset;
 		}
-		break;
-
-	case SVC_Task_Waiting_Time:
-		//Update Scheduler Table
-		Local_enuErrorState = MyRTOS_Update_Scheduler_Tabel();
-		if(Local_enuErrorState != ES_NoError)
-			while(1);
+		else
+		{
+			//the first release tick is passed --> the next release tick after now
+			Periods = ((Release_Tick - Task_Ref_Config->Task_Offset) + Task_Ref_Config->Task_Period - 1) / Task_Ref_Config->Task_Period;
+			Release_Tick = Task_Ref_Config->Task_Offset + (Periods * Task_Ref_Config->Task_Period);
+		}
+	}
 
-		//Update Ready Queue
-		Local_enuErrorState = MyRTOS_Update_Ready_Queue();
-		if(Local_enuErrorState != ES_NoError)
-			while(1);
-		break;
+	return Release_Tick;
+}
 
-	case SVC_Acquire_Mutex:
-		//Update Scheduler Table
-		Local_enuErrorState = MyRTOS_Update_Scheduler_Tabel();
-		if(Local_enuErrorState != ES_NoError)
-			while(1);
+/*
+ * Function Name : OS_Round_Robin_Rotate
+ * Function [IN] : none
+ * Function [OUT]: none
+ * Usage         : it's used every tick to count the time slice of the running task
+ *                 when its time slice is finished it moves to the tail of the ready list
+ *                 of its priority so the other tasks with the same priority take their time slice
+ */
+void OS_Round_Robin_Rotate(void)
+{
+	Task_Ref_t *P_Curr_Task = OS_Control_t.Current_Task;
+	List_t *P_Ready_List = &Ready_Lists[P_Curr_Task->Task_Priority];
 
-		//Update Ready Queue
-		Local_enuErrorState = MyRTOS_Update_Ready_Queue();
-		if(Local_enuErrorState != ES_NoError)
-			while(1);
-		break;
+	//check if the user doesn't terminate the current task and its priority works with Round Robin
+	if(P_Curr_Task->Task_State != Running_State || Time_Slice_Ticks[P_Curr_Task->Task_Priority] == 0)
+		return;
 
-	case SVC_Release_Mutex:
-		//Update Scheduler Table
-		Local_enuErrorState = MyRTOS_Update_Scheduler_Tabel();
-		if(Local_enuErrorState != ES_NoError)
-			while(1);
+	if(OS_Control_t.Time_Slice_Remaining > 0)
+		OS_Control_t.Time_Slice_Remaining--;
 
-		//Update Ready Queue
-		Local_enuErrorState = MyRTOS_Update_Ready_Queue();
-		if(Local_enuErrorState != ES_NoError)
-			while(1);
-		break;
-	}
+	//the time slice is finished --> give the turn to the next task with the same priority
+	if(OS_Control_t.Time_Slice_Remaining == 0)
+	{
+		OS_Control_t.Time_Slice_Remaining = Time_Slice_Ticks[P_Curr_Task->Task_Priority];
 
-	return Local_enuErrorState;
+		if(P_Ready_List->Count > 1)
+		{
+			List_Remove(&P_Curr_Task->Task_State_Node);
+			List_Insert_Tail(P_Ready_List, &P_Curr_Task->Task_State_Node);
+		}
+	}
 }
 
 /*
- * Function Name : MyRTOS_OS_SVC_Set
- * Function [IN] : it takes the ID of service that we need the OS do it
+ * Function Name : MyRTOS_Set_Time_Slice
+ * Function [IN] : it takes the priority level and the number of ticks of its time slice
  * Function [OUT]: it's return the error state of function to check with it if any error happens
- * Usage         : it's used to call SVC with specific to execute specific function
+ * Usage         : it's used to change (at any time) how many ticks a task of this priority runs
+ *                 before the next task with the same priority takes its turn
+ *                 --> No_Ticks = 0 --> no Round Robin (the task runs till it blocks or is preempted)
+ *                 --> EDF band has no Round Robin so its time slice can't be changed
+ *                 --> if the running task has this priority its time slice starts again with the new value
+ *                     (the counter of a disabled time slice is 0 so it would rotate at the next tick)
  */
-MYRTOS_ES_t MyRTOS_OS_SVC_Set(SVC_ID_t svc_id)
+MYRTOS_ES_t MyRTOS_Set_Time_Slice(unsigned char Priority, unsigned int No_Ticks)
 {
 	MYRTOS_ES_t Local_enuErrorState = ES_NoError;
 
-	//we will use svc to reorder Task_Scheduler and update Ready_Queue
-	switch(svc_id)
+	if(Priority >= MyRTOS_Num_of_Priorities || Priority == MyRTOS_EDF_Band_Priority)
 	{
-	case SVC_Activate_Task:
-		__asm("SVC #0x01");
-		break;
+		Local_enuErrorState = ES_Error_Invalid_Priority;
+	}
+	else if(Time_Slice_Ticks[Priority] != No_Ticks)
+	{
+		Time_Slice_Ticks[Priority] = No_Ticks;
 
-	case SVC_Terminate_Task:
-		__asm("SVC #0x02");
-		break;
+		if(OS_Control_t.Current_Task != NULL && OS_Control_t.Current_Task->Task_Priority == Priority)
+			OS_Control_t.Time_Slice_Remaining = No_Ticks;
+	}
 
-	case SVC_Task_Waiting_Time:
-		__asm("SVC #0x03");
-		break;
+	return Local_enuErrorState;
+}
 
-	case SVC_Acquire_Mutex:
-		__asm("SVC #0x04");
-		break;
+/*
+ * Function Name : OS_Decide_What_Next
+ * Function [IN] : none
+ * Function [OUT]: it's return 1 if the next task isn't the current task (PendSV is needed) else 0
+ * Usage         : it's used to decide which task that should run next the current task
+ *                 --> highest ready priority = CLZ(bitmap), next task = head of its ready list
+ *                 --> if the current task will continue running there is no context switch
+ */
+unsigned char OS_Decide_What_Next(void)
+{
+	Task_Ref_t *P_Next_Task;
 
-	case SVC_Release_Mutex:
-		__asm("SVC #0x05");
-		break;
+	//IDLE Task is always ready so the bitmap can't be empty after the OS is started
+	if(Ready_Priority_Bitmap == 0)
+		return 0;
+
+	P_Next_Task = List_Head_Owner(&Ready_Lists[__CLZ(Ready_Priority_Bitmap)]);
+
+	//cancel the previous decision if PendSV didn't do it yet
+	if(OS_Control_t.Next_Task != NULL && OS_Control_t.Next_Task->Task_State == Running_State)
+		OS_Control_t.Next_Task->Task_State = Ready_State;
+	OS_Control_t.Next_Task = NULL;
+
+	//the current task will continue running --> no need to save/restore its context
+	if(P_Next_Task == OS_Control_t.Current_Task)
+	{
+		P_Next_Task->Task_State = Running_State;
+		Clear_OS_PendSV();
+
+		OS_Control_t.Context_Switch_Avoided_Count++;
+		return 0;
 	}
 
-	return Local_enuErrorState;
+	//the current task is still ready but it will not run now (preempted or its time slice finished)
+	if(OS_Control_t.Current_Task != NULL && OS_Control_t.Current_Task->Task_State == Running_State)
+		OS_Control_t.Current_Task->Task_State = Ready_State;
+
+	P_Next_Task->Task_State = Running_State;
+	OS_Control_t.Next_Task = P_Next_Task;
+
+	//the next task starts a new time slice
+	OS_Control_t.Time_Slice_Remaining = Time_Slice_Ticks[P_Next_Task->Task_Priority];
+
+	return 1;
 }
 
 /*
- * Function Name : MyRTOS_Task_Init
- * Function [IN] : it takes a pointer to task configuration and its cofiguration parameters
+ * Function Name : OS_Task_Leave_Delayed_List
+ * Function [IN] : it takes a pointer to the task
  * Function [OUT]: none
- * Usage         : it's used to initialize a task
+ * Usage         : the task may wait for ticks in the delayed list --> it leaves it before any change of its state
  */
-void MyRTOS_Task_Init(Task_Ref_t *Task_Ref_Config, unsigned int Stack_Size, void (*PF)(void), unsigned char Priority, char *Name)
+void OS_Task_Leave_Delayed_List(Task_Ref_t *Task_Ref_Config)
 {
-	Task_Ref_Config->Task_Stack_Size = Stack_Size;
-	Task_Ref_Config->Task_Priority = Priority;
+	if(Task_Ref_Config->Task_State_Node.Container == &Delayed_List)
+		OS_Delayed_List_Remove(Task_Ref_Config);
+}
 
-	Task_Ref_Config->PF_Task_Entry = PF;
+/*
+ * Macro: OS_Task_Waits_Object
+ * --> 1 if the task is blocked on an object (mutex, semaphore, event group, queue or its notification)
+ *     so only this object (or the timeout of the wait) can wake it up
+ */
+#define OS_Task_Waits_Object(P_Task)		(List_Node_Is_Linked(&(P_Task)->Task_Event_Node) || (P_Task)->Task_Notify_State == Notify_Waiting)
 
-	strcpy(Task_Ref_Config->Task_Name, Name);
+/*
+ * Function Name : OS_Task_Leave_Event_List
+ * Function [IN] : it takes a pointer to the task
+ * Function [OUT]: none
+ * Usage         : the task may wait for an object (ex: mutex) --> it leaves its wait list when it's
+ *                 terminated or its timeout is finished (a notification has no wait list)
+ */
+void OS_Task_Leave_Event_List(Task_Ref_t *Task_Ref_Config)
+{
+	if(Task_Ref_Config->Task_Waiting_Mutex != NULL)
+		OS_Mutex_Leave_Wait_List(Task_Ref_Config);
+	else
+		List_Remove(&Task_Ref_Config->Task_Event_Node);
+
+	if(Task_Ref_Config->Task_Notify_State == Notify_Waiting)
+		Task_Ref_Config->Task_Notify_State = Notify_Not_Waiting;
 }
 
 /*
- * Function Name : MyRTOS_Activate_Task
- * Function [IN] : it takes a pointer to task configuration that we need to Activate it
- * Function [OUT]: it's return the error state of function to check with it if any error happens
- * Usage         : it's used to activate task by adding it in waiting state then call SVC
+ * Function Name : OS_Task_Block
+ * Function [IN] : it takes a pointer to the task, the wait list of the object (or NULL) and the timeout
+ * Function [OUT]: none
+ * Usage         : it's used to suspend the task till an object (mutex, semaphore, ...) wakes it up
+ *                 --> the task waits in the wait list of the object (highest priority first)
+ *                     (a notification wakes up its task directly so it has no wait list)
+ *                 --> if Timeout_Ticks isn't MyRTOS_Wait_Forever it waits in the delayed list too
+ *                     and the first of them that wakes it up removes it from the other
+ *                 --> Task_Wait_Result stays ES_Error_Timeout till the object wakes the task up
  */
-MYRTOS_ES_t MyRTOS_Activate_Task(Task_Ref_t *Task_Ref_Config)
+void OS_Task_Block(Task_Ref_t *Task_Ref_Config, List_t *P_Wait_List, unsigned int Timeout_Ticks)
 {
-	MYRTOS_ES_t Local_enuErrorState = ES_NoError;
+	if(P_Wait_List != NULL)
+	{
+		Task_Ref_Config->Task_Event_Node.Item_Value = Task_Ref_Config->Task_Priority;
+		List_Insert_Ordered(P_Wait_List, &Task_Ref_Config->Task_Event_Node);
+	}
 
-	//Task enter waiting state when we activate it
-	Task_Ref_Config->Task_State = Waiting_State;
+	MyRTOS_Ready_List_Remove(Task_Ref_Config);
+	Task_Ref_Config->Task_Wait_Result = ES_Error_Timeout;
 
-	//set svc interrupt to activate the task
-	MyRTOS_OS_SVC_Set(SVC_Activate_Task);
+	if(Timeout_Ticks != MyRTOS_Wait_Forever)
+	{
+		Task_Ref_Config->Task_Timing_Waiting.Task_Blocking = Blocking_Enable;
+		OS_Delayed_List_Insert(Task_Ref_Config, Timeout_Ticks);
+	}
+}
 
+/*
+ * Function Name : OS_Task_Unblock
+ * Function [IN] : it takes a pointer to the task
+ * Function [OUT]: none
+ * Usage         : it's used by the object to wake up a task from its wait list before its timeout
+ *                 then the task is added to the ready list of its priority (the same job continues)
+ */
+void OS_Task_Unblock(Task_Ref_t *Task_Ref_Config)
+{
+	List_Remove(&Task_Ref_Config->Task_Event_Node);
+	OS_Task_Leave_Delayed_List(Task_Ref_Config);
 
-	return Local_enuErrorState;
+	Task_Ref_Config->Task_Wait_Result = ES_NoError;
+
+	if(!List_Node_Is_Linked(&Task_Ref_Config->Task_State_Node))
+	{
+		Task_Ref_Config->Task_State = Waiting_State;
+		MyRTOS_Ready_List_Add(Task_Ref_Config);
+	}
 }
 
 /*
- * Function Name : MyRTOS_Terminate_Task
- * Function [IN] : it takes a pointer to task configuration that we need to Activate it
- * Function [OUT]: it's return the error state of function to check with it if any error happens
- * Usage         : it's used to terminate task by adding it in suspend state then call SVC
+ * Function Name : OS_SVC_Activate_Task
+ * Function [IN] : SVC_Args[0] --> pointer to the task
+ * Function [OUT]: it's return the error state of the service
+ * Usage         : it's used to add the task to the ready list of its priority if it isn't ready already
+ *                 --> a task that waits for an object (mutex, semaphore, event group, queue or notification)
+ *                     isn't activated (ES_Error_Task_Blocked) because it's still in the wait list of the object
+ *                     (its timeout may be in the delayed list too)
  */
-MYRTOS_ES_t MyRTOS_Terminate_Task(Task_Ref_t *Task_Ref_Config)
+unsigned int OS_SVC_Activate_Task(unsigned int *SVC_Args)
 {
 	MYRTOS_ES_t Local_enuErrorState = ES_NoError;
+	Task_Ref_t *P_Task = (Task_Ref_t *)SVC_Args[0];
+	unsigned long long Release_Tick;
 
-	//Task enter suspend state when we terminate it
-	Task_Ref_Config->Task_State = Suspend_State;
+	if(OS_Task_Waits_Object(P_Task))
+	{
+		Local_enuErrorState = ES_Error_Task_Blocked;
+	}
+	else
+	{
+		OS_Task_Leave_Delayed_List(P_Task);
 
-	//set svc interrupt to terminate the task
-	MyRTOS_OS_SVC_Set(SVC_Terminate_Task);
+		if(!List_Node_Is_Linked(&P_Task->Task_State_Node))
+		{
+			//Task enter waiting state when we activate it
+			P_Task->Task_State = Waiting_State;
+
+			//the first job is released now or at the next release tick of a periodic task
+			//(the ticks till it are less than 2^32 --> Task_Offset or Task_Period at most)
+			Release_Tick = OS_First_Release_Tick(P_Task);
+			P_Task->Task_Release_Tick = (unsigned int)Release_Tick;
+			OS_Task_Wait_Release(P_Task, (unsigned int)(Release_Tick - OS_Control_t.Tick_Count));
+		}
+	}
 
 	return Local_enuErrorState;
 }
 
 /*
- * Function Name : MyRTOS_Start_OS
- * Function [IN] : none
- * Function [OUT]: it's return the error state of function to check with it if any error happens
- * Usage         : it's used to start os by set it in running state and ....
+ * Function Name : OS_SVC_Terminate_Task
+ * Function [IN] : SVC_Args[0] --> pointer to the task
+ * Function [OUT]: it's return the error state of the service
+ * Usage         : it's used to remove the task from the ready list (or the delayed list) --> suspend state
+ *                 --> the mutexes that the task holds are released (each one is given to its first waiting task)
+ *                     and the task returns to its base priority (no inherited or ceiling priority)
  */
-MYRTOS_ES_t MyRTOS_Start_OS(void)
+unsigned int OS_SVC_Terminate_Task(unsigned int *SVC_Args)
 {
-	MYRTOS_ES_t Local_enuErrorState = ES_NoError;
-	unsigned int Function_State = 1;
+	Task_Ref_t *P_Task = (Task_Ref_t *)SVC_Args[0];
 
-	//Enter the OS in Running Mode instead of Suspend Mode
-	OS_Control_t.OS_State = OS_Running;
+	OS_Task_Leave_Delayed_List(P_Task);
+	MyRTOS_Ready_List_Remove(P_Task);
 
-	//Set Default Task --> IDLE Task
-	OS_Control_t.Current_Task = &MyRTOS_IDLE_TASK;
+	//the task doesn't wait for a mutex any more
+	OS_Task_Leave_Event_List(P_Task);
 
-	//Activate IDLE Task --> Run IDLE Task
-	Local_enuErrorState = MyRTOS_Activate_Task(&MyRTOS_IDLE_TASK);
+	//the tasks that wait for its mutexes aren't stranded
+	while(!List_Is_Empty(&P_Task->Task_Held_Mutexes))
+		OS_Mutex_Release(List_Head_Owner(&P_Task->Task_Held_Mutexes));
 
-	//Start Ticker --> 1ms
-	Function_State = OS_Start_Ticker();
-	if(Function_State)
-		Local_enuErrorState = ES_Error_SysTick_counting;
+	P_Task->Task_Priority = P_Task->Task_Base_Priority;
 
-	//Set PSP with PSP of Current Task
-	OS_Set_PSP_Val(OS_Control_t.Current_Task->Current_PSP_Task);
+	return ES_NoError;
+}
 
-	//Set SP shadow to PSP instead of MSP
-	OS_Set_SP_shadowto_PSP;
+/*
+ * Function Name : OS_SVC_Task_Waiting_Time
+ * Function [IN] : SVC_Args[0] --> pointer to the task, SVC_Args[1] --> number of ticks
+ * Function [OUT]: it's return the error state of the service
+ * Usage         : it's used to move the task from its ready list to the delayed list (relative time)
+ *                 --> Task_Release_Tick isn't changed so a periodic task keeps its phase
+ *                     (the job after the wait is released at its wake-up tick)
+ */
+unsigned int OS_SVC_Task_Waiting_Time(unsigned int *SVC_Args)
+{
+	Task_Ref_t *P_Task = (Task_Ref_t *)SVC_Args[0];
 
-	//Switch from Privileged to Unprivileged
-	OS_Switch_Privileged_to_Unprivileged;
+	P_Task->Task_Timing_Waiting.Ticks_Count = SVC_Args[1];
+	//the delayed list wakes a task with 0 ticks at the next tick
+	P_Task->Task_Wake_Tick = (unsigned int)OS_Control_t.Tick_Count + ((SVC_Args[1] == 0) ? 1 : SVC_Args[1]);
 
-	//Run Current Task
-	OS_Control_t.Current_Task->PF_Task_Entry();
+	MyRTOS_Ready_List_Remove(P_Task);
+	P_Task->Task_Timing_Waiting.Task_Blocking = Blocking_Enable;
+	OS_Delayed_List_Insert(P_Task, SVC_Args[1]);
+
+	return ES_NoError;
+}
+
+/*
+ * Function Name : OS_SVC_Task_Wait_Until
+ * Function [IN] : SVC_Args[0] --> pointer to the task, SVC_Args[1] --> wake-up tick (absolute)
+ * Function [OUT]: it's return ES_Error_Period_Overrun if the wake-up tick is passed already
+ * Usage         : it's used to move the task from its ready list to the delayed list (absolute time)
+ */
+unsigned int OS_SVC_Task_Wait_Until(unsigned int *SVC_Args)
+{
+	MYRTOS_ES_t Local_enuErrorState = ES_NoError;
+	Task_Ref_t *P_Task = (Task_Ref_t *)SVC_Args[0];
+	unsigned int No_Ticks;
+
+	P_Task->Task_Release_Tick = SVC_Args[1];
+
+	//the wake-up tick is one period (at most) from the last one --> 32-bit signed difference is enough
+	No_Ticks = P_Task->Task_Release_Tick - (unsigned int)OS_Control_t.Tick_Count;
+
+	//the task body took more than its period --> it will not block (but its phase is kept)
+	if((int)No_Ticks <= 0)
+	{
+		Local_enuErrorState = ES_Error_Period_Overrun;
+		No_Ticks = 0;
+	}
+
+	OS_Task_Wait_Release(P_Task, No_Ticks);
 
 	return Local_enuErrorState;
 }
 
+/*
+ * Function Name : OS_SVC_Tickless_Idle
+ * Function [IN] : none
+ * Function [OUT]: it's return the error state of the service
+ * Usage         : IDLE Task asks to suppress the ticks --> no task state is changed
+ */
+unsigned int OS_SVC_Tickless_Idle(unsigned int *SVC_Args)
+{
+	(void)SVC_Args;
+
+	OS_Tickless_Idle_Enter();
+
+	return ES_NoError;
+}
 
 /*
- * Task State:
- *
- * -----------           Task Wait (No_Ticks)           -----------         No_Ticks = 0                    -----------
- * | Running |  	------------------------------>		| Suspend |		------------------------------> 	| Waiting |
- * -----------           Task Blocking Enable           -----------         Task Blocking Disable           -----------
- *
+ * Function Name : OS_SVC_Get_Timestamp
+ * Function [IN] : SVC_Args[0] --> address of the result
+ * Function [OUT]: it's return the error state of the service
+ * Usage         : it's used by tasks to read the timestamp (SysTick registers are privileged)
+ */
+unsigned int OS_SVC_Get_Timestamp(unsigned int *SVC_Args)
+{
+	*((unsigned long long *)SVC_Args[0]) = OS_Get_Timestamp();
+
+	return ES_NoError;
+}
+
+/*
+ * OS Services Table:
+ * --> Service   : the function of the service (index = SVC ID)
+ * --> Reschedule: 1 --> the service may change the ready lists so the OS decides what next after it
  */
+const struct
+{
+	OS_SVC_Service_t Service;
+	unsigned char Reschedule;
+}OS_SVC_Table[SVC_Num_of_Services] =
+{
+	[SVC_Activate_Task]		= {OS_SVC_Activate_Task,		1},
+	[SVC_Terminate_Task]	= {OS_SVC_Terminate_Task,		1},
+	[SVC_Task_Waiting_Time]	= {OS_SVC_Task_Waiting_Time,	1},
+	[SVC_Acquire_Mutex]		= {OS_SVC_Acquire_Mutex,		1},
+	[SVC_Release_Mutex]		= {OS_SVC_Release_Mutex,		1},
+	[SVC_Tickless_Idle]		= {OS_SVC_Tickless_Idle,		0},
+	[SVC_Task_Wait_Until]	= {OS_SVC_Task_Wait_Until,		1},
+	[SVC_Get_Timestamp]		= {OS_SVC_Get_Timestamp,		0},
+	[SVC_Take_Semaphore]	= {OS_SVC_Take_Semaphore,		1},
+	[SVC_Give_Semaphore]	= {OS_SVC_Give_Semaphore,		1},
+	[SVC_Wait_Event_Flags]	= {OS_SVC_Wait_Event_Flags,		1},
+	[SVC_Set_Event_Flags]	= {OS_SVC_Set_Event_Flags,		1},
+	[SVC_Clear_Event_Flags]	= {OS_SVC_Clear_Event_Flags,	0},
+	[SVC_Task_Notify]		= {OS_SVC_Task_Notify,			1},
+	[SVC_Task_Notify_Wait]	= {OS_SVC_Task_Notify_Wait,		1},
+	[SVC_Queue_Send]		= {OS_SVC_Queue_Send,			1},
+	[SVC_Queue_Receive]		= {OS_SVC_Queue_Receive,		1},
+};
 
 /*
- * Function Name : MyRTOS_Task_Wait
- * Function [IN] : it takes the number of tick and pointer to the task
- * Function [OUT]: it's return the error state of function to check with it if any error happens
- * Usage         : it's used to block the task in suspend state for a period of time
+ * Function Name : OS_Kernel_Service
+ * Function [IN] : it takes the ID of the service, a pointer to its arguments (R0-R3) and a pointer
+ *                 to the flag which tells the caller if the OS should switch to another task
+ * Function [OUT]: it's return the result of the service
+ * Usage         : it's used by SVC, the direct call and the interrupts to execute the service from
+ *                 OS_SVC_Table then decide what next if the service may change the ready lists
+ *                 (the caller triggers PendSV --> an interrupt can do it once at its end)
  */
-MYRTOS_ES_t MyRTOS_Task_Wait(unsigned int No_Ticks, Task_Ref_t *Task_Ref_Config)
+unsigned int OS_Kernel_Service(unsigned char SVC_ID, unsigned int *SVC_Args, unsigned char *P_Switch_Needed)
 {
-	MYRTOS_ES_t Local_enuErrorState = ES_NoError;
+	unsigned int Result;
 
-	//Task will enter Suspend state
-	Task_Ref_Config->Task_State = Suspend_State;
+	//any service except tickless idle returns the periodic ticks first (it may make a task ready)
+	if(SVC_ID != SVC_Tickless_Idle)
+		OS_Tickless_Idle_Exit();
 
-	//Enable Blocking and fill the number of ticks
-	Task_Ref_Config->Task_Timing_Waiting.Task_Blocking = Blocking_Enable;
-	Task_Ref_Config->Task_Timing_Waiting.Ticks_Count = No_Ticks;
+	Result = OS_SVC_Table[SVC_ID].Service(SVC_Args);
 
-	//Terminate the task now
-	MyRTOS_Terminate_Task(Task_Ref_Config);
+	//Decide What task should run Next (if it isn't the current task we need PendSV)
+	*P_Switch_Needed = 0;
+	if(OS_SVC_Table[SVC_ID].Reschedule && OS_Control_t.OS_State == OS_Running)
+		*P_Switch_Needed = OS_Decide_What_Next();
 
-	return Local_enuErrorState;
+	return Result;
 }
 
 /*
- * Function Name : MyRTOS_Update_Waiting_Time
- * Function [IN] : none
+ * Function Name : OS_SVC_Services
+ * Function [IN] : it tasks a pointer to the stack frame of the caller (R0, R1, R2, R3, R12, LR, PC, xPSR)
  * Function [OUT]: none
- * Usage         : it's used to see if the time of blocking task is terminated or not
+ * Usage         : it's used to get the SVC ID from the SVC instruction (before the stacked PC) then call
+ *                 its service from OS_SVC_Table with the stacked R0-R3 and put the result in the stacked R0
  */
-void MyRTOS_Update_Waiting_Time(void)
+void OS_SVC_Services(unsigned int *Stack_Frame_Pointer)
 {
-	unsigned int i;
+	unsigned char SVC_ID, Switch_Needed;
+
+	SVC_ID = *((unsigned char *)(((unsigned char *)Stack_Frame_Pointer[6])-2));
 
-	//loop for task that in suspend state and it has its own waiting time
-	for(i = 0; i < OS_Control_t.No_of_Active_Tasks; i++)
+	if(SVC_ID < SVC_Num_of_Services && OS_SVC_Table[SVC_ID].Service != NULL)
 	{
-		if(OS_Control_t.OS_Tasks[i]->Task_State == Suspend_State)
-		{
-			if(OS_Control_t.OS_Tasks[i]->Task_Timing_Waiting.Task_Blocking == Blocking_Enable)
-			{
-				OS_Control_t.OS_Tasks[i]->Task_Timing_Waiting.Ticks_Count--;
-
-				//if the waiting time is finish we will disable blocking and enter the task in waiting state
-				if(OS_Control_t.OS_Tasks[i]->Task_Timing_Waiting.Ticks_Count == 0)
-				{
-					OS_Control_t.OS_Tasks[i]->Task_Timing_Waiting.Task_Blocking = Blocking_Disable;
-					OS_Control_t.OS_Tasks[i]->Task_State = Waiting_State;
-
-					MyRTOS_OS_SVC_Set(SVC_Task_Waiting_Time);
-				}
-			}
-		}
+		Stack_Frame_Pointer[0] = OS_Kernel_Service(SVC_ID, Stack_Frame_Pointer, &Switch_Needed);
+
+		//Trigger OS_PendSV (Switch Context/Restore for our Tasks)
+		if(Switch_Needed)
+			Trigger_OS_PendSV();
 	}
 }
 
 /*
- * Function Name : MyRTOS_Mutex_Init
- * Function [IN] : it takes pointer to Mutex and it's configuration
- * Function [OUT]: none
- * Usage         : it's used to initialize the mutex with the send configuration
+ * Function Name : OS_Direct_Call
+ * Function [IN] : it takes the ID of the service and its arguments
+ * Function [OUT]: it's return the result of the service
+ * Usage         : it's the fast path of privileged callers --> the service is executed without SVC
+ *                 inside a short BASEPRI critical section (SysTick & PendSV are masked so the OS data
+ *                 can't change under us) and the PendSV (if any) is taken when BASEPRI is restored
  */
-void MyRTOS_Mutex_Init(Mutex_Configuration_t *Mutex_Ref_Config, void *PayLoad, unsigned int PayLoad_Size, char *MUTEX_NAME)
+unsigned int OS_Direct_Call(SVC_ID_t SVC_ID, unsigned int Arg0, unsigned int Arg1, unsigned int Arg2, unsigned int Arg3)
 {
-	Mutex_Ref_Config->Current_Task_User = NULL;
-	Mutex_Ref_Config->Next_Task_User = NULL;
+	unsigned int SVC_Args[4] = {Arg0, Arg1, Arg2, Arg3};
+	unsigned int Old_BASEPRI, Result;
+	unsigned char Switch_Needed;
 
-	Mutex_Ref_Config->Data = PayLoad;
-	Mutex_Ref_Config->Data_Size = PayLoad_Size;
+	Old_BASEPRI = OS_Enter_Critical();
 
-	Mutex_Ref_Config->mutex_state = Mutex_Released;
+	Result = OS_Kernel_Service(SVC_ID, SVC_Args, &Switch_Needed);
+	if(Switch_Needed)
+		Trigger_OS_PendSV();
 
-	strcpy(Mutex_Ref_Config->Mutex_Name, MUTEX_NAME);
-}
+	OS_Exit_Critical(Old_BASEPRI);
 
-/*
- * ---------
- * | Task1 |	---> Running 	------> Acquired a Mutex1 			---> Mutex is blocked now
- * ---------
- *
- * ---------
- * | Task2 |	---> Running 	------> Acquire the Mutex1 but it's blocked		---> Suspend
- * ---------
- *
- * after some time ----> Mutex1 is released by Task1
- * then we need to update the scheduler table and enter Task2 in waiting state
- *
- * ---------
- * | Task2 |	---> Waiting	---> Ready		---> Running 	---> so now it can use the shared data
- * ---------
- */
+	return Result;
+}
 
 /*
- * Function Name : MyRTOS_Acquire_Mutex
- * Function [IN] : it takes a pointer to the task and pointer to the Mutex
- * Function [OUT]: it's return the error state of function to check with it if any error happens
- * Usage         : it's used to acquire the mutex by specific task
+ * Function Name : OS_ISR_Call
+ * Function [IN] : it takes the ID of the service, its arguments and a pointer to the flag of the interrupt
+ *                 (Higher_Priority_Task_Woken) or NULL
+ * Function [OUT]: it's return the result of the service
+ * Usage         : it's used by the FromISR APIs --> the service is executed directly inside a BASEPRI
+ *                 critical section (an interrupt can't use SVC) and the OS decides what next
+ *                 --> the flag is set if the interrupt makes a task ready that should run now, then the
+ *                     interrupt calls MyRTOS_Yield_FromISR(flag) at its end to trigger PendSV only once
+ *                 --> if the pointer is NULL PendSV is triggered now (it runs after all interrupts anyway)
  */
-MYRTOS_ES_t MyRTOS_Acquire_Mutex(Task_Ref_t *Task_Ref_Config, Mutex_Configuration_t *Mutex_Config)
+unsigned int OS_ISR_Call(SVC_ID_t SVC_ID, unsigned int Arg0, unsigned int Arg1, unsigned int Arg2, unsigned int Arg3, unsigned char *Higher_Priority_Task_Woken)
 {
-	MYRTOS_ES_t Local_enuErrorState = ES_NoError;
+	unsigned int SVC_Args[4] = {Arg0, Arg1, Arg2, Arg3};
+	unsigned int Old_BASEPRI, Result;
+	unsigned char Switch_Needed;
 
-	//if the mutex is released and is not taken by any task
-	if(Mutex_Config->Current_Task_User == NULL || Mutex_Config->mutex_state == Mutex_Released)
+	if(!OS_ISR_Priority_Is_Valid())
 	{
-		Mutex_Config->Current_Task_User = Task_Ref_Config;
-		Mutex_Config->mutex_state = Mutex_Blocked;
+		Result = ES_Error_Invalid_ISR_Priority;
 	}
-	else	//if the mutex taken and used by the current task
+	else
 	{
-		if(Mutex_Config->Next_Task_User == NULL) //There is no pending Task for this mutex
-		{
-			Mutex_Config->Next_Task_User = Task_Ref_Config;
-
-			//task will enter the suspend state till the mutex is released
-			Task_Ref_Config->Task_State = Suspend_State;
-
-			//terminate the task
-			MyRTOS_OS_SVC_Set(SVC_Terminate_Task);
+		Old_BASEPRI = OS_Enter_Critical();
+		Result = OS_Kernel_Service(SVC_ID, SVC_Args, &Switch_Needed);
+		OS_Exit_Critical(Old_BASEPRI);
 
+		if(Higher_Priority_Task_Woken != NULL)
+		{
+			if(Switch_Needed)
+				*Higher_Priority_Task_Woken = 1;
 		}
-		else	//there is a pending task need this mutex
+		else if(Switch_Needed)
 		{
-			Local_enuErrorState = ES_Error_Many_User_Mutex;
+			Trigger_OS_PendSV();
 		}
 	}
 
-	return Local_enuErrorState;
+	return Result;
 }
 
 /*
- * Function Name : MyRTOS_Release_Mutex
- * Function [IN] : it takes a pointer to the mutex
+ * Function Name : MyRTOS_Yield_FromISR
+ * Function [IN] : it takes the flag that the FromISR APIs set (Higher_Priority_Task_Woken)
  * Function [OUT]: none
- * Usage         : it's used to release a mutex
+ * Usage         : it's called at the end of the interrupt --> if a FromISR API made a task ready that
+ *                 should run now, PendSV is triggered once and it switches to the task when all
+ *                 interrupts are finished (PendSV has the lowest priority)
  */
-void MyRTOS_Release_Mutex(Mutex_Configuration_t *Mutex_Config)
+void MyRTOS_Yield_FromISR(unsigned char Higher_Priority_Task_Woken)
 {
-	if(Mutex_Config->Current_Task_User == NULL || Mutex_Config->mutex_state == Mutex_Blocked)
-	{
-		Mutex_Config->Current_Task_User = Mutex_Config->Next_Task_User;
-		Mutex_Config->Next_Task_User = NULL;
-
-		Mutex_Config->mutex_state = Mutex_Released;
-
-		Mutex_Config->Current_Task_User->Task_State = Waiting_State;
-
-		MyRTOS_Activate_Task(Mutex_Config->Current_Task_User);
-	}
+	if(Higher_Priority_Task_Woken)
+		Trigger_OS_PendSV();
 }
 
 /*
- * 										< Example on Priority Inversion>
- *          ^
- * Priority |
- *          |
- *          |
- *          |     --------------------                                       ---------------------                                                                        ^ low Priority
- *  Task1   |     | Task1 "Completed"|  <--- Acquire Mutex                   | Task1 "Completed" |  <--- Release the Mutex                                                |
- *          |     --------------------                                       ---------------------                                                                        |
- *          |                        |                                       |                    |                                                                       |
- *          |                        |                                       |                    |                                                                       |
- *          |                        |                                       |                    |                                                                       |
- *          |                        |                                       |                    |                                                                       |
- *          |                        ---------                       ---------                    |
- *  Task2   |                        | Task2 |                       | Task2 |                    |
- *          |                        ---------                       ---------                    |
- *          |                                |                       |                            |
- *          |                                |                       |                            |
- *          |                                |                       |                            |
- *          |                                |                       |                            |
- *          |                                -------------------------                            ------------------
- *  Task3   |                                | Task3 "Not Completed" | <--- Acquire same Mutex    | Complete Task3 |   <--- Now, we can acquire the same mutex
- *          |                                -------------------------                            ------------------
- *          |
- *          |______________________________________________________________________________________________________________________________________________________ Time
- *                                                                   ^                            ^
- *                                                                   |                            |
- *                                                                   |----------------------------|
- *                                                                 <Priority Inversion Latency Time >
- *
- *
+ * Function Name : MyRTOS_Set_ISR_Priority
+ * Function [IN] : it takes the IRQ number of the interrupt (ex: EXTI0_IRQ) and its NVIC priority
+ * Function [OUT]: it's return ES_Error_Invalid_ISR_Priority if the priority is higher than the max syscall priority
+ * Usage         : it's used to give an interrupt a priority that can call the FromISR APIs
+ *                 (the NVIC priority of an interrupt is 0 after reset --> its FromISR calls are refused)
+ *                 --> call it from privileged code (main before MyRTOS_Start_OS or a privileged task)
+ *                     because the NVIC registers are privileged
+ *                 ex: MCAL_EXTI_GPIO_Init(&EXTI_CFG);
+ *                     MyRTOS_Set_ISR_Priority(EXTI0_IRQ, MyRTOS_Max_Syscall_Interrupt_Priority);
  */
+MYRTOS_ES_t MyRTOS_Set_ISR_Priority(unsigned int IRQ_Number, unsigned int Priority)
+{
+	MYRTOS_ES_t Local_enuErrorState = ES_NoError;
 
+	if(Priority < MyRTOS_Max_Syscall_Interrupt_Priority)
+		Local_enuErrorState = ES_Error_Invalid_ISR_Priority;
+	else
+		OS_Set_ISR_Priority(IRQ_Number, Priority);
+
+	return Local_enuErrorState;
+}
 
 /*
- * 																		< Example on Dead Lock>
- *          ^
- * Priority |
- *          |
- *          |
- *          |     -------------------------------------------------                                                                                   ----------------------------------------------------------------
- *  Task1   |     | Task1 <--- Acquire Mutex1 then Activate Task3 |                                                                                   | Task1 <--- Acquire Mutex2 but can't because it used by Task3 |
- *          |     -------------------------------------------------                                                                                   ----------------------------------------------------------------
- *          |                                                     |                                                                                  |
- *          |                                                     |                                                                                  |
- *          |                                                     |                                                                                  |
- *          |                                                     |                                                                                  |
- *          |                                                     |                                                                                  |
- *          |                                                     |                                                                                  |
- *          |                                                     |                                                                                  |
- *          |                                                     |                                                                                  |
- *          |                                                     |                                                                                  |
- *          |                                                     |                                                                                  |
- *          |                                                     |                                                                                  |
- *          |                                                     -----------------------------------------------------------------------------------
- *  Task3   |                                                     | Task3 <--- Acquire Mutex2 then Acquire Mutex1 but can't because it used by Task1|
- *          |                                                     |----------------------------------------------------------------------------------
- *          |
- *          |______________________________________________________________________________________________________________________________________________________ Time
- *
+ * Function Name : MyRTOS_Task_Init
+ * Function [IN] : it takes a pointer to task configuration and its cofiguration parameters
+ * Function [OUT]: none
+ * Usage         : it's used to initialize a task
+ */
+void MyRTOS_Task_Init(Task_Ref_t *Task_Ref_Config, unsigned int Stack_Size, void (*PF)(void), unsigned char Priority, char *Name)
+{
+	Task_Ref_Config->Task_Stack_Size = Stack_Size;
+	Task_Ref_Config->Task_Priority = Priority;
+
+	Task_Ref_Config->PF_Task_Entry = PF;
+
+	strcpy(Task_Ref_Config->Task_Name, Name);
+}
+
+/*
+ * Function Name : MyRTOS_Activate_Task
+ * Function [IN] : it takes a pointer to task configuration that we need to Activate it
+ * Function [OUT]: it's return the error state of function to check with it if any error happens
+ * Usage         : it's used to activate task (the OS adds it in waiting state then to its ready list)
+ */
+MYRTOS_ES_t MyRTOS_Activate_Task(Task_Ref_t *Task_Ref_Config)
+{
+	MYRTOS_ES_t Local_enuErrorState = ES_NoError;
+
+	//set svc interrupt to activate the task
+	Local_enuErrorState = OS_Call(SVC_Activate_Task, Task_Ref_Config, 0, 0, 0);
+
+	return Local_enuErrorState;
+}
+
+/*
+ * Function Name : MyRTOS_Activate_Task_FromISR
+ * Function [IN] : it takes a pointer to the task and a pointer to the flag of the interrupt (or NULL)
+ * Function [OUT]: it's return the error state of function to check with it if any error happens
+ * Usage         : it's used to activate a task from an interrupt (ex: EXTI callback)
+ *                 --> the flag is set if the task should run now (see MyRTOS_Yield_FromISR)
+ */
+MYRTOS_ES_t MyRTOS_Activate_Task_FromISR(Task_Ref_t *Task_Ref_Config, unsigned char *Higher_Priority_Task_Woken)
+{
+	MYRTOS_ES_t Local_enuErrorState = ES_NoError;
+
+	Local_enuErrorState = OS_ISR_Call(SVC_Activate_Task, (unsigned int)Task_Ref_Config, 0, 0, 0, Higher_Priority_Task_Woken);
+
+	return Local_enuErrorState;
+}
+
+/*
+ * Function Name : MyRTOS_Terminate_Task
+ * Function [IN] : it takes a pointer to task configuration that we need to Activate it
+ * Function [OUT]: it's return the error state of function to check with it if any error happens
+ * Usage         : it's used to terminate task (the OS removes it from its ready list --> suspend state)
+ */
+MYRTOS_ES_t MyRTOS_Terminate_Task(Task_Ref_t *Task_Ref_Config)
+{
+	MYRTOS_ES_t Local_enuErrorState = ES_NoError;
+
+	//set svc interrupt to terminate the task
+	Local_enuErrorState = OS_Call(SVC_Terminate_Task, Task_Ref_Config, 0, 0, 0);
+
+	return Local_enuErrorState;
+}
+
+/*
+ * Function Name : MyRTOS_Start_OS
+ * Function [IN] : none
+ * Function [OUT]: it's return the error state of function to check with it if any error happens
+ * Usage         : it's used to start os by set it in running state and ....
+ */
+MYRTOS_ES_t MyRTOS_Start_OS(void)
+{
+	MYRTOS_ES_t Local_enuErrorState = ES_NoError;
+	unsigned int Function_State = 1;
+
+	//Activate IDLE Task --> it's always ready at the lowest priority
+	Local_enuErrorState = MyRTOS_Activate_Task(&MyRTOS_IDLE_TASK);
+
+	//Set First Task --> the highest priority ready task
+	OS_Decide_What_Next();
+	OS_Control_t.Current_Task = OS_Control_t.Next_Task;
+	OS_Control_t.Next_Task = NULL;
+
+	//Enter the OS in Running Mode instead of Suspend Mode
+	OS_Control_t.OS_State = OS_Running;
+
+	//Start Ticker --> 1ms
+	Function_State = OS_Start_Ticker();
+	if(Function_State)
+		Local_enuErrorState = ES_Error_SysTick_counting;
+
+	//Set PSP with PSP of Current Task
+	OS_Set_PSP_Val(OS_Control_t.Current_Task->Current_PSP_Task);
+
+	//Set SP shadow to PSP instead of MSP
+	OS_Set_SP_shadowto_PSP;
+
+	//Switch from Privileged to Unprivileged (if the first task isn't a privileged task)
+	if(!OS_Control_t.Current_Task->Task_Privileged)
+		OS_Switch_Privileged_to_Unprivileged;
+
+	//Run Current Task
+	OS_Control_t.Current_Task->PF_Task_Entry();
+
+	return Local_enuErrorState;
+}
+
+
+/*
+ * Function Name : MyRTOS_Get_Context_Switch_Count
+ * Function [IN] : it takes pointers to the variables that will have the counts
+ * Function [OUT]: none
+ * Usage         : it's used to know how many context switches are done and how many are avoided
+ *                 because the current task continued running
+ */
+void MyRTOS_Get_Context_Switch_Count(unsigned int *Switch_Count, unsigned int *Avoided_Count)
+{
+	*Switch_Count = OS_Control_t.Context_Switch_Count;
+	*Avoided_Count = OS_Control_t.Context_Switch_Avoided_Count;
+}
+
+#if (MyRTOS_Kernel_Call_Benchmark == 1)
+//Measure the cycles of one call by SVC (Path = 0) or by the direct call (Path = 1)
+#define OS_Benchmark_Call(Cycles, Path, SVC_ID, Arg0, Arg1)												\
+	do																									\
+	{																									\
+		unsigned int Start_Cycles = DWT->CYCCNT;														\
+		if((Path) == 0)																					\
+			OS_SVC_Call(SVC_ID, Arg0, Arg1, 0, 0);														\
+		else																							\
+			OS_Direct_Call(SVC_ID, (unsigned int)(Arg0), (unsigned int)(Arg1), 0, 0);					\
+		(Cycles)[Path] = DWT->CYCCNT - Start_Cycles;													\
+	}while(0)
+
+/*
+ * Function Name : MyRTOS_Run_Kernel_Call_Benchmark
+ * Function [IN] : it takes a pointer to a created task (not active) and a pointer to a released mutex
+ * Function [OUT]: none
+ * Usage         : it's used to compare the cycles of the kernel calls by SVC and by the direct call
+ *                 (the results are in OS_Kernel_Call_Benchmark)
+ *                 --> call it from privileged code (main before MyRTOS_Start_OS or a privileged task)
+ *                     because it reads the DWT cycle counter and uses the direct call
+ *                 --> if the OS is running and the task has a higher priority, the activation
+ *                     includes the context switch to it
+ */
+void MyRTOS_Run_Kernel_Call_Benchmark(Task_Ref_t *Task_Ref_Config, Mutex_Configuration_t *Mutex_Config)
+{
+	unsigned char Path;
+
+	for(Path = 0; Path < 2; Path++)
+	{
+		OS_Benchmark_Call(OS_Kernel_Call_Benchmark.Activate_Cycles, Path, SVC_Activate_Task, Task_Ref_Config, 0);
+		OS_Benchmark_Call(OS_Kernel_Call_Benchmark.Terminate_Cycles, Path, SVC_Terminate_Task, Task_Ref_Config, 0);
+		OS_Benchmark_Call(OS_Kernel_Call_Benchmark.Acquire_Mutex_Cycles, Path, SVC_Acquire_Mutex, Task_Ref_Config, Mutex_Config);
+		OS_Benchmark_Call(OS_Kernel_Call_Benchmark.Release_Mutex_Cycles, Path, SVC_Release_Mutex, Mutex_Config, 0);
+	}
+}
+#endif
+
+#if (MyRTOS_EDF_Order_Check == 1)
+/*
+ * Function Name : MyRTOS_Run_EDF_Order_Check
+ * Function [IN] : it takes pointers to two created EDF tasks (not active), Released_Task has a shorter
+ *                 Task_Relative_Deadline than Delayed_Task and both of them aren't periodic
+ * Function [OUT]: it's return ES_Error_EDF_Order if the EDF band isn't ordered by the real deadlines
+ * Usage         : it's used to check that a job which is released at the end of a relative wait takes
+ *                 its deadline from the wake-up tick:
+ *                 --> Delayed_Task is released then it waits (MyRTOS_Task_Wait) longer than its relative deadline
+ *                 --> at its wake-up tick Released_Task is released too, so it has the earlier deadline
+ *                     and it must be the head of the EDF band
+ *                 --> call it from main before MyRTOS_Start_OS (it moves the tick count forward)
+ *                     the two tasks are terminated at the end
+ */
+MYRTOS_ES_t MyRTOS_Run_EDF_Order_Check(Task_Ref_t *Delayed_Task, Task_Ref_t *Released_Task)
+{
+	MYRTOS_ES_t Local_enuErrorState = ES_NoError;
+	unsigned int SVC_Args[2];
+	unsigned int Old_BASEPRI, Wait_Ticks, i;
+
+	Old_BASEPRI = OS_Enter_Critical();
+
+	SVC_Args[0] = (unsigned int)Delayed_Task;
+	OS_SVC_Activate_Task(SVC_Args);
+
+	Wait_Ticks = Delayed_Task->Task_Relative_Deadline + 1;
+	SVC_Args[1] = Wait_Ticks;
+	OS_SVC_Task_Waiting_Time(SVC_Args);
+
+	for(i = 0; i < Wait_Ticks; i++)
+		MyRTOS_Update_Waiting_Time();
+
+	SVC_Args[0] = (unsigned int)Released_Task;
+	OS_SVC_Activate_Task(SVC_Args);
+
+	if(List_Head_Owner(&Ready_Lists[MyRTOS_EDF_Band_Priority]) != Released_Task)
+		Local_enuErrorState = ES_Error_EDF_Order;
+
+	OS_SVC_Terminate_Task(SVC_Args);
+	SVC_Args[0] = (unsigned int)Delayed_Task;
+	OS_SVC_Terminate_Task(SVC_Args);
+
+	OS_Exit_Critical(Old_BASEPRI);
+
+	return Local_enuErrorState;
+}
+#endif
+
+/*
+ * Function Name : MyRTOS_Enter_Critical
+ * Function [IN] : none
+ * Function [OUT]: none
+ * Usage         : it's used by privileged code to protect data that it shares with the OS or with
+ *                 the interrupts that use the OS APIs --> it masks them by BASEPRI (max syscall
+ *                 priority) but the interrupts with a higher priority are never masked
+ *                 --> it can be nested and the interrupts are unmasked at the last MyRTOS_Exit_Critical
+ *                 --> no context switch happens inside it (PendSV is masked) so don't wait inside it
+ *                     (the task APIs return ES_Error_In_Critical till the last MyRTOS_Exit_Critical)
+ *                 --> unprivileged tasks can't change BASEPRI (use the OS objects like mutex)
+ */
+void MyRTOS_Enter_Critical(void)
+{
+	unsigned int Old_BASEPRI = OS_Enter_Critical();
+
+	if(OS_Control_t.Critical_Nesting == 0)
+		OS_Control_t.Critical_Old_BASEPRI = Old_BASEPRI;
+
+	OS_Control_t.Critical_Nesting++;
+}
+
+/*
+ * Function Name : MyRTOS_Exit_Critical
+ * Function [IN] : none
+ * Function [OUT]: none
+ * Usage         : it's used to close the critical section of MyRTOS_Enter_Critical
+ */
+void MyRTOS_Exit_Critical(void)
+{
+	if(OS_Control_t.Critical_Nesting > 0)
+	{
+		OS_Control_t.Critical_Nesting--;
+
+		if(OS_Control_t.Critical_Nesting == 0)
+			OS_Exit_Critical(OS_Control_t.Critical_Old_BASEPRI);
+	}
+}
+
+/*
+ * Function Name : MyRTOS_Enter_Critical_FromISR
+ * Function [IN] : none
+ * Function [OUT]: it's return the old mask that MyRTOS_Exit_Critical_FromISR needs
+ * Usage         : it's the critical section of the interrupts (each interrupt keeps its own old mask
+ *                 so it doesn't change the nesting of the interrupted code)
+ */
+unsigned int MyRTOS_Enter_Critical_FromISR(void)
+{
+	return OS_Enter_Critical();
+}
+
+/*
+ * Function Name : MyRTOS_Exit_Critical_FromISR
+ * Function [IN] : it takes the old mask from MyRTOS_Enter_Critical_FromISR
+ * Function [OUT]: none
+ * Usage         : it's used to close the critical section of MyRTOS_Enter_Critical_FromISR
+ */
+void MyRTOS_Exit_Critical_FromISR(unsigned int Old_Mask)
+{
+	OS_Exit_Critical(Old_Mask);
+}
+
+/*
+ * Function Name : MyRTOS_Get_Tick_Count
+ * Function [IN] : none
+ * Function [OUT]: it's return the number of ticks since the OS is started
+ * Usage         : it can be called from tasks or interrupts (it doesn't need SVC)
+ *                 the 64-bit count is read by two 32-bit loads so we read the high word
+ *                 again and repeat if a tick interrupt changed it between the two loads
+ *                 --> ticks suppressed by tickless idle are added when the CPU wakes up
+ */
+unsigned long long MyRTOS_Get_Tick_Count(void)
+{
+	volatile unsigned int *P_Tick_Words = (volatile unsigned int *)&OS_Control_t.Tick_Count;
+	unsigned int Low_Word, High_Word;
+
+	do
+	{
+		High_Word = P_Tick_Words[1];
+		Low_Word = P_Tick_Words[0];
+	}while(High_Word != P_Tick_Words[1]);
+
+	return ((unsigned long long)High_Word << 32) | Low_Word;
+}
+
+/*
+ * Function Name : MyRTOS_Get_Timestamp
+ * Function [IN] : it takes a pointer to the variable that will have the timestamp
+ * Function [OUT]: none
+ * Usage         : it's used to get a high resolution time (SysTick counts since the OS is started)
+ *                 --> one count = 1 / CPU clock and one tick = OS_Ticker_Counts_Per_Tick counts
+ *                 SysTick registers are privileged so a task gets it through SVC and an interrupt
+ *                 (IPSR != 0) gets it through OS_ISR_Call --> in both of them the OS exits tickless idle
+ *                 first and reads the time in a critical section
+ *                 --> an interrupt with a higher priority than MyRTOS_Max_Syscall_Interrupt_Priority gets
+ *                     ES_Error_Invalid_ISR_Priority and the timestamp isn't changed
+ */
+MYRTOS_ES_t MyRTOS_Get_Timestamp(unsigned long long *Timestamp)
+{
+	MYRTOS_ES_t Local_enuErrorState = ES_NoError;
+
+	if(__get_IPSR() != 0)
+		Local_enuErrorState = OS_ISR_Call(SVC_Get_Timestamp, (unsigned int)Timestamp, 0, 0, 0, NULL);
+	else
+		Local_enuErrorState = OS_Call(SVC_Get_Timestamp, Timestamp, 0, 0, 0);
+
+	return Local_enuErrorState;
+}
+
+/*
+ * Task State:
  *
+ * -----------           Task Wait (No_Ticks)           -----------         No_Ticks = 0                    -----------
+ * | Running |  	------------------------------>		| Suspend |		------------------------------> 	| Waiting |
+ * -----------           Task Blocking Enable           -----------         Task Blocking Disable           -----------
  *
  */
+
+/*
+ * Function Name : MyRTOS_Task_Wait
+ * Function [IN] : it takes the number of tick and pointer to the task
+ * Function [OUT]: it's return the error state of function to check with it if any error happens
+ * Usage         : it's used to block the task in suspend state for a period of time
+ */
+MYRTOS_ES_t MyRTOS_Task_Wait(unsigned int No_Ticks, Task_Ref_t *Task_Ref_Config)
+{
+	MYRTOS_ES_t Local_enuErrorState = ES_NoError;
+
+	//set svc interrupt to move the task to the delayed list (Task will enter Suspend state)
+	Local_enuErrorState = OS_Call(SVC_Task_Waiting_Time, Task_Ref_Config, No_Ticks, 0, 0);
+
+	return Local_enuErrorState;
+}
+
+/*
+ * Function Name : MyRTOS_Task_Delay_Until
+ * Function [IN] : it takes a pointer to the last wake-up tick, the period and pointer to the task
+ * Function [OUT]: it's return ES_Error_Period_Overrun if the next wake-up tick is passed already
+ * Usage         : it's used to block the task till (last wake-up tick + period)
+ *                 the wake-up tick is absolute (OS tick count) so the period doesn't drift by the time
+ *                 of the task body or the scheduling latency
+ *                 --> initialize *Previous_Wake_Tick once then call it at the end of each period
+ */
+MYRTOS_ES_t MyRTOS_Task_Delay_Until(unsigned int *Previous_Wake_Tick, unsigned int Period_Ticks, Task_Ref_t *Task_Ref_Config)
+{
+	MYRTOS_ES_t Local_enuErrorState = ES_NoError;
+
+	*Previous_Wake_Tick += Period_Ticks;
+
+	//set svc interrupt to move the task to the delayed list (it returns ES_Error_Period_Overrun
+	//if the wake-up tick is passed already)
+	Local_enuErrorState = OS_Call(SVC_Task_Wait_Until, Task_Ref_Config, *Previous_Wake_Tick, 0, 0);
+
+	return Local_enuErrorState;
+}
+
+/*
+ * Function Name : MyRTOS_Task_Wait_Next_Period
+ * Function [IN] : it takes a pointer to the periodic task (Task_Period != 0)
+ * Function [OUT]: it's return ES_Error_Period_Overrun if the next release tick is passed already
+ * Usage         : it's used at the end of each job of a periodic task to wait for its next release
+ *                 --> next release = Task_Offset + k * Task_Period (anchored to the OS tick count)
+ */
+MYRTOS_ES_t MyRTOS_Task_Wait_Next_Period(Task_Ref_t *Task_Ref_Config)
+{
+	return MyRTOS_Task_Delay_Until(&Task_Ref_Config->Task_Release_Tick, Task_Ref_Config->Task_Period, Task_Ref_Config);
+}
+
+/*
+ * Function Name : MyRTOS_Update_Waiting_Time
+ * Function [IN] : none
+ * Function [OUT]: none
+ * Usage         : it's used every tick to count the tick and to see if the time of blocking tasks is terminated or not
+ *                 we decrement the head of the delta list only then wake up all tasks at its head
+ *                 that have zero ticks --> the cost doesn't depend on the number of tasks
+ *                 the tasks are added to the ready lists directly (SysTick can't preempt SVC so no
+ *                 service is changing the lists now) and SysTick_Handler decides what next only once
+ *                 after all of them are ready
+ */
+void MyRTOS_Update_Waiting_Time(void)
+{
+	Task_Ref_t *P_Task;
+
+	OS_Control_t.Tick_Count++;
+
+	if(List_Is_Empty(&Delayed_List))
+		return;
+
+	if(Delayed_List.Head->Item_Value > 0)
+		Delayed_List.Head->Item_Value--;
+
+	//if the waiting time is finish we will disable blocking and enter the task in waiting state
+	while(!List_Is_Empty(&Delayed_List) && Delayed_List.Head->Item_Value == 0)
+	{
+		P_Task = List_Head_Owner(&Delayed_List);
+		OS_Delayed_List_Remove(P_Task);
+
+		P_Task->Task_State = Waiting_State;
+
+		if(OS_Task_Waits_Object(P_Task))
+		{
+			//the timeout of waiting for an object is finished --> the same job continues
+			//(Task_Wait_Result is still ES_Error_Timeout)
+			OS_Task_Leave_Event_List(P_Task);
+			MyRTOS_Ready_List_Add(P_Task);
+		}
+		else
+		{
+			//the waiting time is finished --> new job is released
+			OS_Release_Job(P_Task);
+		}
+	}
+}
+
+/*
+ * Function Name : MyRTOS_Mutex_Init
+ * Function [IN] : it takes pointer to Mutex and it's configuration
+ * Function [OUT]: none
+ * Usage         : it's used to initialize the mutex with the send configuration
+ */
+void MyRTOS_Mutex_Init(Mutex_Configuration_t *Mutex_Ref_Config, void *PayLoad, unsigned int PayLoad_Size, char *MUTEX_NAME)
+{
+	Mutex_Ref_Config->Current_Task_User = NULL;
+	List_Init(&Mutex_Ref_Config->Waiting_Tasks);
+	List_Node_Init(&Mutex_Ref_Config->Mutex_Holder_Node, Mutex_Ref_Config);
+
+	Mutex_Ref_Config->Data = PayLoad;
+	Mutex_Ref_Config->Data_Size = PayLoad_Size;
+
+	Mutex_Ref_Config->mutex_state = Mutex_Released;
+
+	Mutex_Ref_Config->Mutex_Protocol = Mutex_Priority_Inheritance;
+	Mutex_Ref_Config->Mutex_Ceiling_Priority = 0;
+
+	strcpy(Mutex_Ref_Config->Mutex_Name, MUTEX_NAME);
+}
+
+/*
+ * Function Name : MyRTOS_Mutex_Init_Ceiling
+ * Function [IN] : it takes pointer to Mutex, it's configuration and the ceiling priority
+ * Function [OUT]: none
+ * Usage         : it's used to initialize a priority ceiling mutex (Immediate Priority Ceiling Protocol)
+ *                 --> the ceiling = the highest priority of the tasks that use the mutex
+ *                 --> the task takes the ceiling priority once it acquires the mutex so no task that
+ *                     uses the mutex can preempt it --> the mutex is always free when a task asks
+ *                     for it (no blocking chain, no dead lock) and a task is blocked only one time
+ *                 --> the task must not wait (ex: MyRTOS_Task_Wait) while it holds the mutex
+ */
+void MyRTOS_Mutex_Init_Ceiling(Mutex_Configuration_t *Mutex_Ref_Config, void *PayLoad, unsigned int PayLoad_Size, char *MUTEX_NAME, unsigned char Ceiling_Priority)
+{
+	MyRTOS_Mutex_Init(Mutex_Ref_Config, PayLoad, PayLoad_Size, MUTEX_NAME);
+
+	Mutex_Ref_Config->Mutex_Protocol = Mutex_Priority_Ceiling;
+	Mutex_Ref_Config->Mutex_Ceiling_Priority = Ceiling_Priority;
+}
+
+/*
+ * ---------
+ * | Task1 |	---> Running 	------> Acquired a Mutex1 			---> Mutex is blocked now
+ * ---------
+ *
+ * ---------
+ * | Task2 |	---> Running 	------> Acquire the Mutex1 but it's blocked		---> Suspend
+ * ---------
+ *
+ * after some time ----> Mutex1 is released by Task1
+ * then we need to update the scheduler table and enter Task2 in waiting state
+ *
+ * ---------
+ * | Task2 |	---> Waiting	---> Ready		---> Running 	---> so now it can use the shared data
+ * ---------
+ */
+
+/*
+ * Function Name : OS_Task_Set_Priority
+ * Function [IN] : it takes a pointer to the task and its new priority
+ * Function [OUT]: none
+ * Usage         : it's used by priority inheritance to change the priority of the task now
+ *                 --> a ready task moves to the ready list of the new priority (a running task
+ *                     goes to the head of it so it continues running)
+ *                 --> a task that waits for a mutex takes its new position in the wait list
+ */
+void OS_Task_Set_Priority(Task_Ref_t *Task_Ref_Config, unsigned char Priority)
+{
+	enum Task_State_t State = Task_Ref_Config->Task_State;
+	List_Node_t *P_Node;
+	List_t *P_List;
+
+	if(Task_Ref_Config->Task_State_Node.Container == &Ready_Lists[Task_Ref_Config->Task_Priority])
+	{
+		MyRTOS_Ready_List_Remove(Task_Ref_Config);
+		Task_Ref_Config->Task_Priority = Priority;
+		MyRTOS_Ready_List_Add(Task_Ref_Config);
+
+		if(State == Running_State && Priority != MyRTOS_EDF_Band_Priority)
+		{
+			List_Remove(&Task_Ref_Config->Task_State_Node);
+			List_Insert_Head(&Ready_Lists[Priority], &Task_Ref_Config->Task_State_Node);
+		}
+		Task_Ref_Config->Task_State = State;
+	}
+	else
+	{
+		Task_Ref_Config->Task_Priority = Priority;
+	}
+
+	if(List_Node_Is_Linked(&Task_Ref_Config->Task_Event_Node))
+	{
+		P_Node = &Task_Ref_Config->Task_Event_Node;
+		P_List = P_Node->Container;
+
+		List_Remove(P_Node);
+		P_Node->Item_Value = Priority;
+		List_Insert_Ordered(P_List, P_Node);
+	}
+}
+
+/*
+ * Function Name : OS_Task_Inherited_Priority
+ * Function [IN] : it takes a pointer to the task
+ * Function [OUT]: it's return the priority that the task should have now
+ * Usage         : the task takes the highest priority of its base priority and the first waiting
+ *                 task of each mutex that it holds (or the ceiling of a priority ceiling mutex)
+ */
+unsigned char OS_Task_Inherited_Priority(Task_Ref_t *Task_Ref_Config)
+{
+	unsigned char Priority = Task_Ref_Config->Task_Base_Priority;
+	List_Node_t *P_Node = Task_Ref_Config->Task_Held_Mutexes.Head;
+	Mutex_Configuration_t *P_Mutex;
+	Task_Ref_t *P_Top_Waiter;
+
+	while(P_Node != NULL)
+	{
+		P_Mutex = P_Node->Owner;
+
+		if(P_Mutex->Mutex_Protocol == Mutex_Priority_Ceiling)
+		{
+			if(P_Mutex->Mutex_Ceiling_Priority < Priority)
+				Priority = P_Mutex->Mutex_Ceiling_Priority;
+		}
+		else if(!List_Is_Empty(&P_Mutex->Waiting_Tasks))
+		{
+			P_Top_Waiter = List_Head_Owner(&P_Mutex->Waiting_Tasks);
+			if(P_Top_Waiter->Task_Priority < Priority)
+				Priority = P_Top_Waiter->Task_Priority;
+		}
+
+		P_Node = P_Node->Next;
+	}
+
+	return Priority;
+}
+
+/*
+ * Function Name : OS_Mutex_Update_Holders
+ * Function [IN] : it takes a pointer to the mutex that its wait list is changed
+ * Function [OUT]: none
+ * Usage         : it's used to give the holder of the mutex the priority of its first waiting task
+ *                 (or to return it back) then the same for the mutex that the holder waits for
+ *                 (transitive inheritance) --> it stops when a priority doesn't change
+ */
+void OS_Mutex_Update_Holders(Mutex_Configuration_t *Mutex_Config)
+{
+	Task_Ref_t *P_Holder;
+	unsigned char Priority;
+
+	//the waiting tasks of a priority ceiling mutex don't change the priority of its holder
+	while(Mutex_Config != NULL && Mutex_Config->Current_Task_User != NULL && Mutex_Config->Mutex_Protocol == Mutex_Priority_Inheritance)
+	{
+		P_Holder = Mutex_Config->Current_Task_User;
+		Priority = OS_Task_Inherited_Priority(P_Holder);
+
+		if(Priority == P_Holder->Task_Priority)
+		{
+			Mutex_Config = NULL;
+		}
+		else
+		{
+			OS_Task_Set_Priority(P_Holder, Priority);
+			Mutex_Config = P_Holder->Task_Waiting_Mutex;
+		}
+	}
+}
+
+/*
+ * Function Name : OS_Mutex_Take
+ * Function [IN] : it takes a pointer to the mutex and a pointer to the task
+ * Function [OUT]: none
+ * Usage         : it's used to make the task the holder of the mutex
+ */
+void OS_Mutex_Take(Mutex_Configuration_t *Mutex_Config, Task_Ref_t *Task_Ref_Config)
+{
+	Mutex_Config->Current_Task_User = Task_Ref_Config;
+	Mutex_Config->mutex_state = Mutex_Blocked;
+
+	Task_Ref_Config->Task_Waiting_Mutex = NULL;
+	List_Insert_Tail(&Task_Ref_Config->Task_Held_Mutexes, &Mutex_Config->Mutex_Holder_Node);
+}
+
+/*
+ * Function Name : OS_Mutex_Leave_Wait_List
+ * Function [IN] : it takes a pointer to the task
+ * Function [OUT]: none
+ * Usage         : it's used when a waiting task stops waiting for its mutex (ex: terminated)
+ *                 so the holder doesn't keep the priority that it inherits from this task
+ */
+void OS_Mutex_Leave_Wait_List(Task_Ref_t *Task_Ref_Config)
+{
+	Mutex_Configuration_t *P_Mutex = Task_Ref_Config->Task_Waiting_Mutex;
+
+	if(P_Mutex != NULL)
+	{
+		List_Remove(&Task_Ref_Config->Task_Event_Node);
+		Task_Ref_Config->Task_Waiting_Mutex = NULL;
+
+		OS_Mutex_Update_Holders(P_Mutex);
+	}
+}
+
+/*
+ * Function Name : OS_SVC_Acquire_Mutex
+ * Function [IN] : SVC_Args[0] --> pointer to the task, SVC_Args[1] --> pointer to the Mutex
+ *                 SVC_Args[2] --> timeout (0 --> don't wait, MyRTOS_Wait_Forever --> no timeout)
+ * Function [OUT]: it's return the error state of the service
+ * Usage         : it's used to give the mutex to the task or block the task till the mutex is released
+ *                 or its timeout is finished (the result of the wait is in Task_Wait_Result)
+ *                 it runs in the OS (SVC) so no other task can take the mutex in the middle of it
+ */
+unsigned int OS_SVC_Acquire_Mutex(unsigned int *SVC_Args)
+{
+	MYRTOS_ES_t Local_enuErrorState = ES_NoError;
+	Task_Ref_t *P_Task = (Task_Ref_t *)SVC_Args[0];
+	Mutex_Configuration_t *Mutex_Config = (Mutex_Configuration_t *)SVC_Args[1];
+	unsigned int Timeout_Ticks = SVC_Args[2];
+
+	P_Task->Task_Wait_Result = ES_NoError;
+
+	//Priority Ceiling --> the ceiling must be the highest priority of the tasks that use the mutex
+	if(Mutex_Config->Mutex_Protocol == Mutex_Priority_Ceiling && P_Task->Task_Base_Priority < Mutex_Config->Mutex_Ceiling_Priority)
+	{
+		Local_enuErrorState = ES_Error_Mutex_Ceiling_Violation;
+	}
+	//if the mutex is released and is not taken by any task
+	else if(Mutex_Config->Current_Task_User == NULL || Mutex_Config->mutex_state == Mutex_Released)
+	{
+		OS_Mutex_Take(Mutex_Config, P_Task);
+
+		//Priority Ceiling --> the task runs with the ceiling priority till it releases the mutex
+		if(Mutex_Config->Mutex_Protocol == Mutex_Priority_Ceiling && Mutex_Config->Mutex_Ceiling_Priority < P_Task->Task_Priority)
+			OS_Task_Set_Priority(P_Task, Mutex_Config->Mutex_Ceiling_Priority);
+	}
+	//the mutex is taken and the task doesn't wait
+	else if(Timeout_Ticks == 0)
+	{
+		Local_enuErrorState = ES_Error_Mutex_Busy;
+	}
+	else	//if the mutex taken and used by another task
+	{
+		//the task waits in the wait list of the mutex --> ordered by priority (FIFO for the same priority)
+		//task will enter the suspend state till the mutex is released (or the timeout is finished)
+		OS_Task_Block(P_Task, &Mutex_Config->Waiting_Tasks, Timeout_Ticks);
+		P_Task->Task_Waiting_Mutex = Mutex_Config;
+
+		//Priority Inheritance --> the holder (and the holders before it) run with the priority of the task
+		OS_Mutex_Update_Holders(Mutex_Config);
+	}
+
+	return Local_enuErrorState;
+}
+
+/*
+ * Function Name : OS_Mutex_Release
+ * Function [IN] : it takes a pointer to the Mutex
+ * Function [OUT]: none
+ * Usage         : it's used to release the mutex and give it to the highest priority waiting task
+ *                 (the head of the wait list --> O(1)) which enters waiting state
+ *                 (by its holder or by the OS when its holder is terminated)
+ */
+void OS_Mutex_Release(Mutex_Configuration_t *Mutex_Config)
+{
+	Task_Ref_t *P_Task = Mutex_Config->Current_Task_User;
+
+	if(P_Task == NULL || Mutex_Config->mutex_state == Mutex_Blocked)
+	{
+		Mutex_Config->Current_Task_User = NULL;
+		Mutex_Config->mutex_state = Mutex_Released;
+
+		//the old holder returns to the priority without the waiting tasks of this mutex
+		if(P_Task != NULL)
+		{
+			List_Remove(&Mutex_Config->Mutex_Holder_Node);
+			OS_Task_Set_Priority(P_Task, OS_Task_Inherited_Priority(P_Task));
+		}
+
+		//there is a pending task for this mutex so it takes it and enters waiting state
+		//then it's added to the ready list of its priority (the same job continues)
+		if(!List_Is_Empty(&Mutex_Config->Waiting_Tasks))
+		{
+			P_Task = List_Head_Owner(&Mutex_Config->Waiting_Tasks);
+			OS_Task_Unblock(P_Task);
+			OS_Mutex_Take(Mutex_Config, P_Task);
+
+			if(Mutex_Config->Mutex_Protocol == Mutex_Priority_Ceiling && Mutex_Config->Mutex_Ceiling_Priority < P_Task->Task_Priority)
+				OS_Task_Set_Priority(P_Task, Mutex_Config->Mutex_Ceiling_Priority);
+
+			//the new holder inherits the priority of the tasks that still wait
+			OS_Mutex_Update_Holders(Mutex_Config);
+		}
+	}
+}
+
+/*
+ * Function Name : OS_SVC_Release_Mutex
+ * Function [IN] : SVC_Args[0] --> pointer to the Mutex
+ * Function [OUT]: it's return the error state of the service
+ * Usage         : it's used to release the mutex (see OS_Mutex_Release)
+ */
+unsigned int OS_SVC_Release_Mutex(unsigned int *SVC_Args)
+{
+	OS_Mutex_Release((Mutex_Configuration_t *)SVC_Args[0]);
+
+	return ES_NoError;
+}
+
+/*
+ * Function Name : MyRTOS_Acquire_Mutex
+ * Function [IN] : it takes a pointer to the task and pointer to the Mutex
+ * Function [OUT]: it's return the error state of function to check with it if any error happens
+ * Usage         : it's used to acquire the mutex by specific task (it waits till the mutex is released)
+ */
+MYRTOS_ES_t MyRTOS_Acquire_Mutex(Task_Ref_t *Task_Ref_Config, Mutex_Configuration_t *Mutex_Config)
+{
+	return MyRTOS_Acquire_Mutex_Timeout(Task_Ref_Config, Mutex_Config, MyRTOS_Wait_Forever);
+}
+
+/*
+ * Function Name : MyRTOS_Try_Acquire_Mutex
+ * Function [IN] : it takes a pointer to the task and pointer to the Mutex
+ * Function [OUT]: it's return ES_Error_Mutex_Busy if the mutex is taken by another task
+ * Usage         : it's used to acquire the mutex only if it's free now (the task never waits)
+ */
+MYRTOS_ES_t MyRTOS_Try_Acquire_Mutex(Task_Ref_t *Task_Ref_Config, Mutex_Configuration_t *Mutex_Config)
+{
+	return MyRTOS_Acquire_Mutex_Timeout(Task_Ref_Config, Mutex_Config, 0);
+}
+
+/*
+ * Function Name : MyRTOS_Acquire_Mutex_Timeout
+ * Function [IN] : it takes a pointer to the task, pointer to the Mutex and the maximum ticks to wait
+ * Function [OUT]: it's return ES_Error_Timeout if the mutex isn't released before the timeout
+ * Usage         : it's used to acquire the mutex but the task waits only for Timeout_Ticks
+ *                 (0 --> don't wait, MyRTOS_Wait_Forever --> no timeout)
+ *                 --> the task is removed from the wait list of the mutex when the timeout is finished
+ */
+MYRTOS_ES_t MyRTOS_Acquire_Mutex_Timeout(Task_Ref_t *Task_Ref_Config, Mutex_Configuration_t *Mutex_Config, unsigned int Timeout_Ticks)
+{
+	MYRTOS_ES_t Local_enuErrorState = ES_NoError;
+
+	Local_enuErrorState = OS_Call(SVC_Acquire_Mutex, Task_Ref_Config, Mutex_Config, Timeout_Ticks, 0);
+
+	//the task waited --> the OS put the result of the wait in the task
+	if(Local_enuErrorState == ES_NoError)
+		Local_enuErrorState = Task_Ref_Config->Task_Wait_Result;
+
+	return Local_enuErrorState;
+}
+
+/*
+ * Function Name : MyRTOS_Release_Mutex
+ * Function [IN] : it takes a pointer to the mutex
+ * Function [OUT]: none
+ * Usage         : it's used to release a mutex
+ */
+void MyRTOS_Release_Mutex(Mutex_Configuration_t *Mutex_Config)
+{
+	OS_Call(SVC_Release_Mutex, Mutex_Config, 0, 0, 0);
+}
+
+/*
+ * 										< Example on Priority Inversion>
+ *          ^
+ * Priority |
+ *          |
+ *          |
+ *          |     --------------------                                       ---------------------                                                                        ^ low Priority
+ *  Task1   |     | Task1 "Completed"|  <--- Acquire Mutex                   | Task1 "Completed" |  <--- Release the Mutex                                                |
+ *          |     --------------------                                       ---------------------                                                                        |
+ *          |                        |                                       |                    |                                                                       |
+ *          |                        |                                       |                    |                                                                       |
+ *          |                        |                                       |                    |                                                                       |
+ *          |                        |                                       |                    |                                                                       |
+ *          |                        ---------                       ---------                    |
+ *  Task2   |                        | Task2 |                       | Task2 |                    |
+ *          |                        ---------                       ---------                    |
+ *          |                                |                       |                            |
+ *          |                                |                       |                            |
+ *          |                                |                       |                            |
+ *          |                                |                       |                            |
+ *          |                                -------------------------                            ------------------
+ *  Task3   |                                | Task3 "Not Completed" | <--- Acquire same Mutex    | Complete Task3 |   <--- Now, we can acquire the same mutex
+ *          |                                -------------------------                            ------------------
+ *          |
+ *          |______________________________________________________________________________________________________________________________________________________ Time
+ *                                                                   ^                            ^
+ *                                                                   |                            |
+ *                                                                   |----------------------------|
+ *                                                                 <Priority Inversion Latency Time >
+ *
+ *
+ */
+
+
+/*
+ * 																		< Example on Dead Lock>
+ *          ^
+ * Priority |
+ *          |
+ *          |
+ *          |     -------------------------------------------------                                                                                   ----------------------------------------------------------------
+ *  Task1   |     | Task1 <--- Acquire Mutex1 then Activate Task3 |                                                                                   | Task1 <--- Acquire Mutex2 but can't because it used by Task3 |
+ *          |     -------------------------------------------------                                                                                   ----------------------------------------------------------------
+ *          |                                                     |                                                                                  |
+ *          |                                                     |                                                                                  |
+ *          |                                                     |                                                                                  |
+ *          |                                                     |                                                                                  |
+ *          |                                                     |                                                                                  |
+ *          |                                                     |                                                                                  |
+ *          |                                                     |                                                                                  |
+ *          |                                                     |                                                                                  |
+ *          |                                                     |                                                                                  |
+ *          |                                                     |                                                                                  |
+ *          |                                                     |                                                                                  |
+ *          |                                                     -----------------------------------------------------------------------------------
+ *  Task3   |                                                     | Task3 <--- Acquire Mutex2 then Acquire Mutex1 but can't because it used by Task1|
+ *          |                                                     |----------------------------------------------------------------------------------
+ *          |
+ *          |______________________________________________________________________________________________________________________________________________________ Time
+ *
+ *
+ *
+ */
+
+//-*-*-*-*-*-*-*-*-*-*-*-*-*-*-
+//Counting Semaphore:
+//-*-*-*-*-*-*-*-*-*-*-*-*-*-*-
+/*
+ * --> Take: if there is a token the count is decremented, else the task waits in the wait list of the semaphore
+ * --> Give: if a task waits the token is given to the first one directly (the count doesn't change)
+ *           else the count is incremented --> both of them are O(1) (no change of the other tasks)
+ *
+ * Example: producer / consumer
+ *          ------------                        -------------                        ------------
+ *          | Producer | ---> Give_Semaphore ---> | Semaphore | ---> Take_Semaphore ---> | Consumer |
+ *          ------------                        -------------                        ------------
+ */
+
+/*
+ * Function Name : OS_SVC_Take_Semaphore
+ * Function [IN] : SVC_Args[0] --> pointer to the task, SVC_Args[1] --> pointer to the semaphore
+ *                 SVC_Args[2] --> timeout (0 --> don't wait, MyRTOS_Wait_Forever --> no timeout)
+ * Function [OUT]: it's return the error state of the service
+ * Usage         : it's used to take a token or block the task till a token is given or its timeout is finished
+ */
+unsigned int OS_SVC_Take_Semaphore(unsigned int *SVC_Args)
+{
+	MYRTOS_ES_t Local_enuErrorState = ES_NoError;
+	Task_Ref_t *P_Task = (Task_Ref_t *)SVC_Args[0];
+	Semaphore_Configuration_t *Semaphore_Config = (Semaphore_Configuration_t *)SVC_Args[1];
+	unsigned int Timeout_Ticks = SVC_Args[2];
+
+	P_Task->Task_Wait_Result = ES_NoError;
+
+	if(Semaphore_Config->Semaphore_Count > 0)
+	{
+		Semaphore_Config->Semaphore_Count--;
+	}
+	else if(Timeout_Ticks == 0)
+	{
+		Local_enuErrorState = ES_Error_Semaphore_Empty;
+	}
+	else
+	{
+		OS_Task_Block(P_Task, &Semaphore_Config->Waiting_Tasks, Timeout_Ticks);
+	}
+
+	return Local_enuErrorState;
+}
+
+/*
+ * Function Name : OS_SVC_Give_Semaphore
+ * Function [IN] : SVC_Args[0] --> pointer to the semaphore
+ * Function [OUT]: it's return the error state of the service
+ * Usage         : it's used to wake up the first waiting task or to increment the count
+ */
+unsigned int OS_SVC_Give_Semaphore(unsigned int *SVC_Args)
+{
+	MYRTOS_ES_t Local_enuErrorState = ES_NoError;
+	Semaphore_Configuration_t *Semaphore_Config = (Semaphore_Configuration_t *)SVC_Args[0];
+
+	if(!List_Is_Empty(&Semaphore_Config->Waiting_Tasks))
+	{
+		OS_Task_Unblock(List_Head_Owner(&Semaphore_Config->Waiting_Tasks));
+	}
+	else if(Semaphore_Config->Semaphore_Count < Semaphore_Config->Semaphore_Max_Count)
+	{
+		Semaphore_Config->Semaphore_Count++;
+	}
+	else
+	{
+		Local_enuErrorState = ES_Error_Semaphore_Full;
+	}
+
+	return Local_enuErrorState;
+}
+
+/*
+ * Function Name : MyRTOS_Semaphore_Init
+ * Function [IN] : it takes pointer to the semaphore, its initial count, its max count and its name
+ * Function [OUT]: it's return ES_Error_Semaphore_Invalid_Count if Max_Count is 0 or Initial_Count is more than Max_Count
+ * Usage         : it's used to initialize the counting semaphore (Max_Count = 1 --> binary semaphore)
+ */
+MYRTOS_ES_t MyRTOS_Semaphore_Init(Semaphore_Configuration_t *Semaphore_Config, unsigned int Initial_Count, unsigned int Max_Count, char *SEMAPHORE_NAME)
+{
+	MYRTOS_ES_t Local_enuErrorState = ES_NoError;
+
+	if(Max_Count == 0 || Initial_Count > Max_Count)
+	{
+		Local_enuErrorState = ES_Error_Semaphore_Invalid_Count;
+	}
+	else
+	{
+		Semaphore_Config->Semaphore_Count = Initial_Count;
+		Semaphore_Config->Semaphore_Max_Count = Max_Count;
+		List_Init(&Semaphore_Config->Waiting_Tasks);
+
+		strcpy(Semaphore_Config->Semaphore_Name, SEMAPHORE_NAME);
+	}
+
+	return Local_enuErrorState;
+}
+
+/*
+ * Function Name : MyRTOS_Take_Semaphore
+ * Function [IN] : it takes a pointer to the task, pointer to the semaphore and the maximum ticks to wait
+ * Function [OUT]: it's return ES_Error_Semaphore_Empty (no wait) or ES_Error_Timeout if no token is taken
+ * Usage         : it's used to take a token from the semaphore
+ *                 (0 --> don't wait, MyRTOS_Wait_Forever --> no timeout)
+ */
+MYRTOS_ES_t MyRTOS_Take_Semaphore(Task_Ref_t *Task_Ref_Config, Semaphore_Configuration_t *Semaphore_Config, unsigned int Timeout_Ticks)
+{
+	MYRTOS_ES_t Local_enuErrorState = ES_NoError;
+
+	Local_enuErrorState = OS_Call(SVC_Take_Semaphore, Task_Ref_Config, Semaphore_Config, Timeout_Ticks, 0);
+
+	//the task waited --> the OS put the result of the wait in the task
+	if(Local_enuErrorState == ES_NoError)
+		Local_enuErrorState = Task_Ref_Config->Task_Wait_Result;
+
+	return Local_enuErrorState;
+}
+
+/*
+ * Function Name : MyRTOS_Give_Semaphore
+ * Function [IN] : it takes a pointer to the semaphore
+ * Function [OUT]: it's return ES_Error_Semaphore_Full if the count is already Max_Count
+ * Usage         : it's used to give a token to the semaphore from a task
+ */
+MYRTOS_ES_t MyRTOS_Give_Semaphore(Semaphore_Configuration_t *Semaphore_Config)
+{
+	MYRTOS_ES_t Local_enuErrorState = ES_NoError;
+
+	Local_enuErrorState = OS_Call(SVC_Give_Semaphore, Semaphore_Config, 0, 0, 0);
+
+	return Local_enuErrorState;
+}
+
+/*
+ * Function Name : MyRTOS_Give_Semaphore_FromISR
+ * Function [IN] : it takes a pointer to the semaphore and pointer to the flag of the woken task (or NULL)
+ * Function [OUT]: it's return ES_Error_Semaphore_Full if the count is already Max_Count
+ * Usage         : it's used to give a token to the semaphore from an interrupt
+ *                 (see MyRTOS_Activate_Task_FromISR for the flag and MyRTOS_Yield_FromISR)
+ */
+MYRTOS_ES_t MyRTOS_Give_Semaphore_FromISR(Semaphore_Configuration_t *Semaphore_Config, unsigned char *Higher_Priority_Task_Woken)
+{
+	MYRTOS_ES_t Local_enuErrorState = ES_NoError;
+
+	Local_enuErrorState = OS_ISR_Call(SVC_Give_Semaphore, (unsigned int)Semaphore_Config, 0, 0, 0, Higher_Priority_Task_Woken);
+
+	return Local_enuErrorState;
+}
+
+//-*-*-*-*-*-*-*-*-*-*-*-*-*-*-
+//Event Flags:
+//-*-*-*-*-*-*-*-*-*-*-*-*-*-*-
+/*
+ * --> each group has 32 flags, the task waits for any or all flags of its mask
+ * --> Set checks all waiting tasks in one pass and wakes up every task that its condition is true
+ *     then the scheduler decides one time only (from a task or from an ISR)
+ *
+ * Example:                 ---------------------------------
+ *          EXTI0 ---> Set  |  ...  | 0 | 0 | 1 | 0 | 1 |   |  ---> Wait_All (Mask = 0x5) ---> Task
+ *          Task1 ---> Set  ---------------------------------
+ */
+#define OS_Event_Flags_Satisfied(Flags, Mask, Options)		(((Options) & MyRTOS_Event_Wait_All) ? 	\
+															 (((Flags) & (Mask)) == (Mask)) :		\
+															 (((Flags) & (Mask)) != 0))
+
+/*
+ * Function Name : OS_SVC_Wait_Event_Flags
+ * Function [IN] : SVC_Args[0] --> pointer to the task (its Task_Event_Mask & Task_Event_Options are filled)
+ *                 SVC_Args[1] --> pointer to the event group
+ *                 SVC_Args[2] --> timeout (0 --> don't wait, MyRTOS_Wait_Forever --> no timeout)
+ * Function [OUT]: it's return the error state of the service
+ * Usage         : it's used to finish the wait now if the flags are already set or block the task till they are set
+ */
+unsigned int OS_SVC_Wait_Event_Flags(unsigned int *SVC_Args)
+{
+	MYRTOS_ES_t Local_enuErrorState = ES_NoError;
+	Task_Ref_t *P_Task = (Task_Ref_t *)SVC_Args[0];
+	Event_Group_Configuration_t *Event_Group_Config = (Event_Group_Configuration_t *)SVC_Args[1];
+	unsigned int Timeout_Ticks = SVC_Args[2];
+
+	P_Task->Task_Wait_Result = ES_NoError;
+	P_Task->Task_Event_Flags = Event_Group_Config->Event_Flags;
+
+	if(OS_Event_Flags_Satisfied(Event_Group_Config->Event_Flags, P_Task->Task_Event_Mask, P_Task->Task_Event_Options))
+	{
+		if(P_Task->Task_Event_Options & MyRTOS_Event_Clear_On_Exit)
+			Event_Group_Config->Event_Flags &= ~P_Task->Task_Event_Mask;
+	}
+	else if(Timeout_Ticks == 0)
+	{
+		Local_enuErrorState = ES_Error_Timeout;
+	}
+	else
+	{
+		OS_Task_Block(P_Task, &Event_Group_Config->Waiting_Tasks, Timeout_Ticks);
+	}
+
+	return Local_enuErrorState;
+}
+
+/*
+ * Function Name : OS_SVC_Set_Event_Flags
+ * Function [IN] : SVC_Args[0] --> pointer to the event group, SVC_Args[1] --> flags to set
+ * Function [OUT]: it's return the error state of the service
+ * Usage         : it's used to set the flags and wake up all waiting tasks that their condition is true
+ *                 --> the flags of Clear_On_Exit tasks are cleared after the pass so every task sees the same flags
+ */
+unsigned int OS_SVC_Set_Event_Flags(unsigned int *SVC_Args)
+{
+	Event_Group_Configuration_t *Event_Group_Config = (Event_Group_Configuration_t *)SVC_Args[0];
+	List_Node_t *P_Node, *P_Next;
+	Task_Ref_t *P_Task;
+	unsigned int Clear_Mask = 0;
+
+	Event_Group_Config->Event_Flags |= SVC_Args[1];
+
+	P_Node = Event_Group_Config->Waiting_Tasks.Head;
+	while(P_Node != NULL)
+	{
+		P_Next = P_Node->Next;
+		P_Task = P_Node->Owner;
+
+		if(OS_Event_Flags_Satisfied(Event_Group_Config->Event_Flags, P_Task->Task_Event_Mask, P_Task->Task_Event_Options))
+		{
+			P_Task->Task_Event_Flags = Event_Group_Config->Event_Flags;
+
+			if(P_Task->Task_Event_Options & MyRTOS_Event_Clear_On_Exit)
+				Clear_Mask |= P_Task->Task_Event_Mask;
+
+			OS_Task_Unblock(P_Task);
+		}
+
+		P_Node = P_Next;
+	}
+
+	Event_Group_Config->Event_Flags &= ~Clear_Mask;
+
+	return ES_NoError;
+}
+
+/*
+ * Function Name : OS_SVC_Clear_Event_Flags
+ * Function [IN] : SVC_Args[0] --> pointer to the event group, SVC_Args[1] --> flags to clear
+ * Function [OUT]: it's return the error state of the service
+ * Usage         : it's used to clear the flags (no task wakes up so no need to decide what next)
+ */
+unsigned int OS_SVC_Clear_Event_Flags(unsigned int *SVC_Args)
+{
+	Event_Group_Configuration_t *Event_Group_Config = (Event_Group_Configuration_t *)SVC_Args[0];
+
+	Event_Group_Config->Event_Flags &= ~SVC_Args[1];
+
+	return ES_NoError;
+}
+
+/*
+ * Function Name : MyRTOS_Event_Group_Init
+ * Function [IN] : it takes pointer to the event group and its name
+ * Function [OUT]: none
+ * Usage         : it's used to initialize the event group with all flags cleared
+ */
+void MyRTOS_Event_Group_Init(Event_Group_Configuration_t *Event_Group_Config, char *EVENT_GROUP_NAME)
+{
+	Event_Group_Config->Event_Flags = 0;
+	List_Init(&Event_Group_Config->Waiting_Tasks);
+
+	strcpy(Event_Group_Config->Event_Group_Name, EVENT_GROUP_NAME);
+}
+
+/*
+ * Function Name : MyRTOS_Wait_Event_Flags
+ * Function [IN] : it takes a pointer to the task, pointer to the event group, the mask of the flags,
+ *                 the options (MyRTOS_Event_Wait_Any or MyRTOS_Event_Wait_All | MyRTOS_Event_Clear_On_Exit),
+ *                 the maximum ticks to wait and pointer to return the flags of the group (or NULL)
+ * Function [OUT]: it's return ES_Error_Timeout if the condition isn't true before the timeout
+ *                 (ES_Error_Event_Invalid_Mask if the mask is 0 --> no set can wake the task up)
+ * Usage         : it's used to block the task till any or all flags of the mask are set
+ *                 (0 --> don't wait, MyRTOS_Wait_Forever --> no timeout)
+ */
+MYRTOS_ES_t MyRTOS_Wait_Event_Flags(Task_Ref_t *Task_Ref_Config, Event_Group_Configuration_t *Event_Group_Config, unsigned int Mask, unsigned char Options, unsigned int Timeout_Ticks, unsigned int *Flags)
+{
+	MYRTOS_ES_t Local_enuErrorState = ES_NoError;
+
+	if(Mask == 0)
+	{
+		Local_enuErrorState = ES_Error_Event_Invalid_Mask;
+	}
+	else
+	{
+		//the condition of the wait is kept in the task so Set can check it later
+		Task_Ref_Config->Task_Event_Mask = Mask;
+		Task_Ref_Config->Task_Event_Options = Options;
+
+		Local_enuErrorState = OS_Call(SVC_Wait_Event_Flags, Task_Ref_Config, Event_Group_Config, Timeout_Ticks, 0);
+
+		//the task waited --> the OS put the result of the wait in the task
+		if(Local_enuErrorState == ES_NoError)
+			Local_enuErrorState = Task_Ref_Config->Task_Wait_Result;
+
+		if(Flags != NULL)
+			*Flags = Task_Ref_Config->Task_Event_Flags;
+	}
+
+	return Local_enuErrorState;
+}
+
+/*
+ * Function Name : MyRTOS_Set_Event_Flags
+ * Function [IN] : it takes a pointer to the event group and the flags to set
+ * Function [OUT]: none
+ * Usage         : it's used to set flags from a task and wake up the tasks that wait for them
+ */
+void MyRTOS_Set_Event_Flags(Event_Group_Configuration_t *Event_Group_Config, unsigned int Mask)
+{
+	OS_Call(SVC_Set_Event_Flags, Event_Group_Config, Mask, 0, 0);
+}
+
+/*
+ * Function Name : MyRTOS_Set_Event_Flags_FromISR
+ * Function [IN] : it takes a pointer to the event group, the flags to set and pointer to the flag of the woken task (or NULL)
+ * Function [OUT]: it's return the error state of function to check with it if any error happens
+ * Usage         : it's used to set flags from an interrupt --> all satisfied tasks wake up in one scheduling pass
+ *                 (see MyRTOS_Activate_Task_FromISR for the flag and MyRTOS_Yield_FromISR)
+ */
+MYRTOS_ES_t MyRTOS_Set_Event_Flags_FromISR(Event_Group_Configuration_t *Event_Group_Config, unsigned int Mask, unsigned char *Higher_Priority_Task_Woken)
+{
+	MYRTOS_ES_t Local_enuErrorState = ES_NoError;
+
+	Local_enuErrorState = OS_ISR_Call(SVC_Set_Event_Flags, (unsigned int)Event_Group_Config, Mask, 0, 0, Higher_Priority_Task_Woken);
+
+	return Local_enuErrorState;
+}
+
+/*
+ * Function Name : MyRTOS_Clear_Event_Flags
+ * Function [IN] : it takes a pointer to the event group and the flags to clear
+ * Function [OUT]: none
+ * Usage         : it's used to clear flags of the group
+ */
+void MyRTOS_Clear_Event_Flags(Event_Group_Configuration_t *Event_Group_Config, unsigned int Mask)
+{
+	OS_Call(SVC_Clear_Event_Flags, Event_Group_Config, Mask, 0, 0);
+}
+
+//-*-*-*-*-*-*-*-*-*-*-*-*-*-*-
+//Task Notifications:
+//-*-*-*-*-*-*-*-*-*-*-*-*-*-*-
+/*
+ * --> each task has one notification value and one state in its TCB (no object and no wait list)
+ * --> Notify changes the value by the action then wakes up the task directly if it waits
+ *     else the notification stays pending till the task waits for it
+ * --> only the task itself waits for its notification (one consumer), any task or ISR can notify it
+ */
+
+/*
+ * Function Name : OS_SVC_Task_Notify
+ * Function [IN] : SVC_Args[0] --> pointer to the task, SVC_Args[1] --> value, SVC_Args[2] --> action
+ * Function [OUT]: it's return the error state of the service
+ * Usage         : it's used to change the notification value of the task and wake it up if it waits
+ */
+unsigned int OS_SVC_Task_Notify(unsigned int *SVC_Args)
+{
+	Task_Ref_t *P_Task = (Task_Ref_t *)SVC_Args[0];
+	unsigned int Value = SVC_Args[1];
+
+	switch((enum Notify_Action_t)SVC_Args[2])
+	{
+	case MyRTOS_Notify_Set_Bits:
+		P_Task->Task_Notify_Value |= Value;
+		break;
+	case MyRTOS_Notify_Increment:
+		P_Task->Task_Notify_Value++;
+		break;
+	case MyRTOS_Notify_Overwrite:
+		P_Task->Task_Notify_Value = Value;
+		break;
+	default:
+		break;
+	}
+
+	if(P_Task->Task_Notify_State == Notify_Waiting)
+	{
+		//the task takes the value now and clears the bits of its mask
+		P_Task->Task_Event_Flags = P_Task->Task_Notify_Value;
+		P_Task->Task_Notify_Value &= ~P_Task->Task_Event_Mask;
+		P_Task->Task_Notify_State = Notify_Not_Waiting;
+
+		OS_Task_Unblock(P_Task);
+	}
+	else
+	{
+		P_Task->Task_Notify_State = Notify_Pending;
+	}
+
+	return ES_NoError;
+}
+
+/*
+ * Function Name : OS_SVC_Task_Notify_Wait
+ * Function [IN] : SVC_Args[0] --> pointer to the task (its Task_Event_Mask has the bits to clear)
+ *                 SVC_Args[1] --> timeout (0 --> don't wait, MyRTOS_Wait_Forever --> no timeout)
+ * Function [OUT]: it's return the error state of the service
+ * Usage         : it's used to take the pending notification now or block the task till it's notified
+ */
+unsigned int OS_SVC_Task_Notify_Wait(unsigned int *SVC_Args)
+{
+	MYRTOS_ES_t Local_enuErrorState = ES_NoError;
+	Task_Ref_t *P_Task = (Task_Ref_t *)SVC_Args[0];
+	unsigned int Timeout_Ticks = SVC_Args[1];
+
+	P_Task->Task_Wait_Result = ES_NoError;
+	P_Task->Task_Event_Flags = P_Task->Task_Notify_Value;
+
+	if(P_Task->Task_Notify_State == Notify_Pending)
+	{
+		P_Task->Task_Notify_Value &= ~P_Task->Task_Event_Mask;
+		P_Task->Task_Notify_State = Notify_Not_Waiting;
+	}
+	else if(Timeout_Ticks == 0)
+	{
+		Local_enuErrorState = ES_Error_Timeout;
+	}
+	else
+	{
+		P_Task->Task_Notify_State = Notify_Waiting;
+		OS_Task_Block(P_Task, NULL, Timeout_Ticks);
+	}
+
+	return Local_enuErrorState;
+}
+
+/*
+ * Function Name : MyRTOS_Task_Notify
+ * Function [IN] : it takes a pointer to the task, the value and the action
+ * Function [OUT]: none
+ * Usage         : it's used to notify the task from another task
+ *                 (MyRTOS_Notify_Set_Bits, MyRTOS_Notify_Increment, MyRTOS_Notify_Overwrite or MyRTOS_Notify_No_Action)
+ */
+void MyRTOS_Task_Notify(Task_Ref_t *Task_Ref_Config, unsigned int Value, enum Notify_Action_t Action)
+{
+	OS_Call(SVC_Task_Notify, Task_Ref_Config, Value, Action, 0);
+}
+
+/*
+ * Function Name : MyRTOS_Task_Notify_FromISR
+ * Function [IN] : it takes a pointer to the task, the value, the action and pointer to the flag of the woken task (or NULL)
+ * Function [OUT]: it's return the error state of function to check with it if any error happens
+ * Usage         : it's used to notify the task from an interrupt (the cheapest wake-up of a task)
+ *                 (see MyRTOS_Activate_Task_FromISR for the flag and MyRTOS_Yield_FromISR)
+ */
+MYRTOS_ES_t MyRTOS_Task_Notify_FromISR(Task_Ref_t *Task_Ref_Config, unsigned int Value, enum Notify_Action_t Action, unsigned char *Higher_Priority_Task_Woken)
+{
+	MYRTOS_ES_t Local_enuErrorState = ES_NoError;
+
+	Local_enuErrorState = OS_ISR_Call(SVC_Task_Notify, (unsigned int)Task_Ref_Config, Value, Action, 0, Higher_Priority_Task_Woken);
+
+	return Local_enuErrorState;
+}
+
+/*
+ * Function Name : MyRTOS_Task_Notify_Wait
+ * Function [IN] : it takes a pointer to the task, the bits to clear when it takes the notification,
+ *                 the maximum ticks to wait and pointer to return the notification value (or NULL)
+ * Function [OUT]: it's return ES_Error_Timeout if no notification comes before the timeout
+ * Usage         : it's used by the task to wait for its notification
+ *                 --> Clear_On_Exit_Mask = 0xFFFFFFFF resets the value (ex: takes all counts of Increment)
+ *                 (0 --> don't wait, MyRTOS_Wait_Forever --> no timeout)
+ */
+MYRTOS_ES_t MyRTOS_Task_Notify_Wait(Task_Ref_t *Task_Ref_Config, unsigned int Clear_On_Exit_Mask, unsigned int Timeout_Ticks, unsigned int *Value)
+{
+	MYRTOS_ES_t Local_enuErrorState = ES_NoError;
+
+	Task_Ref_Config->Task_Event_Mask = Clear_On_Exit_Mask;
+
+	Local_enuErrorState = OS_Call(SVC_Task_Notify_Wait, Task_Ref_Config, Timeout_Ticks, 0, 0);
+
+	//the task waited --> the OS put the result of the wait in the task
+	if(Local_enuErrorState == ES_NoError)
+		Local_enuErrorState = Task_Ref_Config->Task_Wait_Result;
+
+	if(Value != NULL)
+		*Value = Task_Ref_Config->Task_Event_Flags;
+
+	return Local_enuErrorState;
+}
+
+//-*-*-*-*-*-*-*-*-*-*-*-*-*-*-
+//Message Queues:
+//-*-*-*-*-*-*-*-*-*-*-*-*-*-*-
+/*
+ * --> the items are copied into the FIFO in the storage of the user (no dynamic memory)
+ * --> if a task waits for an item, Send copies the item to its buffer directly (it doesn't pass by the FIFO)
+ * --> if a task waits for a free place, Receive takes its item into the FIFO then wakes it up
+ * --> zero-copy: a queue of pointers (Item_Size = sizeof(void *)) passes only the address of a large frame
+ *     and the frame is owned by the receiver till it gives it back (ex: by another queue of free frames)
+ *
+ *          ----------                 ---------------------------                 ------------
+ *          | Sender | ---> Send ---> | item | item | item |  ...  | ---> Receive ---> | Receiver |
+ *          ----------                 ---------------------------                 ------------
+ */
+
+/*
+ * Function Name : OS_SVC_Queue_Send
+ * Function [IN] : SVC_Args[0] --> pointer to the task (NULL from an ISR), SVC_Args[1] --> pointer to the queue
+ *                 SVC_Args[2] --> pointer to the item, SVC_Args[3] --> timeout (0 --> don't wait)
+ * Function [OUT]: it's return the error state of the service
+ * Usage         : it's used to give the item to the first waiting receiver, or put it in the FIFO,
+ *                 or block the task till there is a free place or its timeout is finished
+ */
+unsigned int OS_SVC_Queue_Send(unsigned int *SVC_Args)
+{
+	MYRTOS_ES_t Local_enuErrorState = ES_NoError;
+	Task_Ref_t *P_Task = (Task_Ref_t *)SVC_Args[0];
+	Queue_Configuration_t *Queue_Config = (Queue_Configuration_t *)SVC_Args[1];
+	void *Item = (void *)SVC_Args[2];
+	unsigned int Timeout_Ticks = SVC_Args[3];
+	Task_Ref_t *P_Receiver;
+
+	if(P_Task != NULL)
+		P_Task->Task_Wait_Result = ES_NoError;
+
+	if(!List_Is_Empty(&Queue_Config->Waiting_Receivers))
+	{
+		//the FIFO is empty --> the item goes to the receiver directly
+		P_Receiver = List_Head_Owner(&Queue_Config->Waiting_Receivers);
+		memcpy(P_Receiver->Task_Wait_Buffer, Item, Queue_Config->Queue_FIFO.item_size);
+		OS_Task_Unblock(P_Receiver);
+	}
+	else if(FIFO_Enqueue_Item(&Queue_Config->Queue_FIFO, Item) == FIFO_no_error)
+	{
+		//the item is in the FIFO now
+	}
+	else if(Timeout_Ticks == 0 || P_Task == NULL)
+	{
+		Local_enuErrorState = ES_Error_Queue_Full;
+	}
+	else
+	{
+		//the item stays with the task till a receiver makes a free place
+		P_Task->Task_Wait_Buffer = Item;
+		OS_Task_Block(P_Task, &Queue_Config->Waiting_Senders, Timeout_Ticks);
+	}
+
+	return Local_enuErrorState;
+}
+
+/*
+ * Function Name : OS_SVC_Queue_Receive
+ * Function [IN] : SVC_Args[0] --> pointer to the task, SVC_Args[1] --> pointer to the queue
+ *                 SVC_Args[2] --> pointer to the buffer of the item, SVC_Args[3] --> timeout (0 --> don't wait)
+ * Function [OUT]: it's return the error state of the service
+ * Usage         : it's used to take the oldest item (then the first waiting sender puts its item in the free place)
+ *                 or block the task till an item is sent or its timeout is finished
+ */
+unsigned int OS_SVC_Queue_Receive(unsigned int *SVC_Args)
+{
+	MYRTOS_ES_t Local_enuErrorState = ES_NoError;
+	Task_Ref_t *P_Task = (Task_Ref_t *)SVC_Args[0];
+	Queue_Configuration_t *Queue_Config = (Queue_Configuration_t *)SVC_Args[1];
+	void *Item = (void *)SVC_Args[2];
+	unsigned int Timeout_Ticks = SVC_Args[3];
+	Task_Ref_t *P_Sender;
+
+	P_Task->Task_Wait_Result = ES_NoError;
+
+	if(FIFO_Dequeue_Item(&Queue_Config->Queue_FIFO, Item) == FIFO_no_error)
+	{
+		if(!List_Is_Empty(&Queue_Config->Waiting_Senders))
+		{
+			P_Sender = List_Head_Owner(&Queue_Config->Waiting_Senders);
+			FIFO_Enqueue_Item(&Queue_Config->Queue_FIFO, P_Sender->Task_Wait_Buffer);
+			OS_Task_Unblock(P_Sender);
+		}
+	}
+	else if(Timeout_Ticks == 0)
+	{
+		Local_enuErrorState = ES_Error_Queue_Empty;
+	}
+	else
+	{
+		//the sender copies the item to this buffer when it comes
+		P_Task->Task_Wait_Buffer = Item;
+		OS_Task_Block(P_Task, &Queue_Config->Waiting_Receivers, Timeout_Ticks);
+	}
+
+	return Local_enuErrorState;
+}
+
+/*
+ * Function Name : MyRTOS_Queue_Init
+ * Function [IN] : it takes pointer to the queue, its storage, max number of items, size of one item and its name
+ * Function [OUT]: it's return ES_Error_Queue_Invalid_Storage if the storage is NULL, the sizes are 0
+ *                 or Length * Item_Size doesn't fit in 32 bits
+ * Usage         : it's used to initialize the queue on a static storage of MyRTOS_Queue_Storage_Size(Length, Item_Size) bytes
+ *                 (Item_Size = sizeof(void *) --> zero-copy queue of pointers)
+ */
+MYRTOS_ES_t MyRTOS_Queue_Init(Queue_Configuration_t *Queue_Config, void *Storage, unsigned int Length, unsigned int Item_Size, char *QUEUE_NAME)
+{
+	MYRTOS_ES_t Local_enuErrorState = ES_NoError;
+
+	if(FIFO_init(&Queue_Config->Queue_FIFO, Storage, Length, Item_Size) != FIFO_no_error)
+	{
+		Local_enuErrorState = ES_Error_Queue_Invalid_Storage;
+	}
+	else
+	{
+		List_Init(&Queue_Config->Waiting_Senders);
+		List_Init(&Queue_Config->Waiting_Receivers);
+
+		strcpy(Queue_Config->Queue_Name, QUEUE_NAME);
+	}
+
+	return Local_enuErrorState;
+}
+
+/*
+ * Function Name : MyRTOS_Queue_Send
+ * Function [IN] : it takes a pointer to the task, pointer to the queue, pointer to the item and the maximum ticks to wait
+ * Function [OUT]: it's return ES_Error_Queue_Full (no wait) or ES_Error_Timeout if the item isn't sent
+ * Usage         : it's used to copy the item to the queue (0 --> don't wait, MyRTOS_Wait_Forever --> no timeout)
+ */
+MYRTOS_ES_t MyRTOS_Queue_Send(Task_Ref_t *Task_Ref_Config, Queue_Configuration_t *Queue_Config, const void *Item, unsigned int Timeout_Ticks)
+{
+	MYRTOS_ES_t Local_enuErrorState = ES_NoError;
+
+	Local_enuErrorState = OS_Call(SVC_Queue_Send, Task_Ref_Config, Queue_Config, Item, Timeout_Ticks);
+
+	//the task waited --> the OS put the result of the wait in the task
+	if(Local_enuErrorState == ES_NoError)
+		Local_enuErrorState = Task_Ref_Config->Task_Wait_Result;
+
+	return Local_enuErrorState;
+}
+
+/*
+ * Function Name : MyRTOS_Queue_Send_FromISR
+ * Function [IN] : it takes a pointer to the queue, pointer to the item and pointer to the flag of the woken task (or NULL)
+ * Function [OUT]: it's return ES_Error_Queue_Full if there is no free place (an interrupt never waits)
+ * Usage         : it's used to copy the item to the queue from an interrupt
+ *                 (see MyRTOS_Activate_Task_FromISR for the flag and MyRTOS_Yield_FromISR)
+ */
+MYRTOS_ES_t MyRTOS_Queue_Send_FromISR(Queue_Configuration_t *Queue_Config, const void *Item, unsigned char *Higher_Priority_Task_Woken)
+{
+	MYRTOS_ES_t Local_enuErrorState = ES_NoError;
+
+	Local_enuErrorState = OS_ISR_Call(SVC_Queue_Send, 0, (unsigned int)Queue_Config, (unsigned int)Item, 0, Higher_Priority_Task_Woken);
+
+	return Local_enuErrorState;
+}
+
+/*
+ * Function Name : MyRTOS_Queue_Receive
+ * Function [IN] : it takes a pointer to the task, pointer to the queue, pointer to the buffer of the item and the maximum ticks to wait
+ * Function [OUT]: it's return ES_Error_Queue_Empty (no wait) or ES_Error_Timeout if no item is received
+ * Usage         : it's used to copy the oldest item of the queue to the buffer (0 --> don't wait, MyRTOS_Wait_Forever --> no timeout)
+ */
+MYRTOS_ES_t MyRTOS_Queue_Receive(Task_Ref_t *Task_Ref_Config, Queue_Configuration_t *Queue_Config, void *Item, unsigned int Timeout_Ticks)
+{
+	MYRTOS_ES_t Local_enuErrorState = ES_NoError;
+
+	Local_enuErrorState = OS_Call(SVC_Queue_Receive, Task_Ref_Config, Queue_Config, Item, Timeout_Ticks);
+
+	//the task waited --> the OS put the result of the wait in the task
+	if(Local_enuErrorState == ES_NoError)
+		Local_enuErrorState = Task_Ref_Config->Task_Wait_Result;
+
+	return Local_enuErrorState;
+}
+
+/*
+ * Function Name : MyRTOS_Queue_Send_Pointer
+ * Function [IN] : it takes a pointer to the task, pointer to the queue of pointers, pointer to the frame and the maximum ticks to wait
+ * Function [OUT]: it's return the error state of MyRTOS_Queue_Send
+ *                 (ES_Error_Queue_Invalid_Storage if the items of the queue aren't pointers)
+ * Usage         : it's used to pass a large frame without copying it (only its address is copied)
+ *                 --> the sender must not change the frame after it's sent
+ */
+MYRTOS_ES_t MyRTOS_Queue_Send_Pointer(Task_Ref_t *Task_Ref_Config, Queue_Configuration_t *Queue_Config, void *Frame, unsigned int Timeout_Ticks)
+{
+	MYRTOS_ES_t Local_enuErrorState = ES_NoError;
+
+	//only the address is copied --> a bigger item would read past it
+	if(Queue_Config->Queue_FIFO.item_size != sizeof(void *))
+		Local_enuErrorState = ES_Error_Queue_Invalid_Storage;
+	else
+		Local_enuErrorState = MyRTOS_Queue_Send(Task_Ref_Config, Queue_Config, &Frame, Timeout_Ticks);
+
+	return Local_enuErrorState;
+}
+
+/*
+ * Function Name : MyRTOS_Queue_Send_Pointer_FromISR
+ * Function [IN] : it takes a pointer to the queue of pointers, pointer to the frame and pointer to the flag of the woken task (or NULL)
+ * Function [OUT]: it's return the error state of MyRTOS_Queue_Send_FromISR
+ *                 (ES_Error_Queue_Invalid_Storage if the items of the queue aren't pointers)
+ * Usage         : it's used to pass a large frame from an interrupt without copying it
+ */
+MYRTOS_ES_t MyRTOS_Queue_Send_Pointer_FromISR(Queue_Configuration_t *Queue_Config, void *Frame, unsigned char *Higher_Priority_Task_Woken)
+{
+	MYRTOS_ES_t Local_enuErrorState = ES_NoError;
+
+	if(Queue_Config->Queue_FIFO.item_size != sizeof(void *))
+		Local_enuErrorState = ES_Error_Queue_Invalid_Storage;
+	else
+		Local_enuErrorState = MyRTOS_Queue_Send_FromISR(Queue_Config, &Frame, Higher_Priority_Task_Woken);
+
+	return Local_enuErrorState;
+}
+
+/*
+ * Function Name : MyRTOS_Queue_Receive_Pointer
+ * Function [IN] : it takes a pointer to the task, pointer to the queue of pointers, pointer to return the frame and the maximum ticks to wait
+ * Function [OUT]: it's return the error state of MyRTOS_Queue_Receive
+ *                 (ES_Error_Queue_Invalid_Storage if the items of the queue aren't pointers)
+ * Usage         : it's used to receive the address of a large frame (the frame isn't copied)
+ */
+MYRTOS_ES_t MyRTOS_Queue_Receive_Pointer(Task_Ref_t *Task_Ref_Config, Queue_Configuration_t *Queue_Config, void **Frame, unsigned int Timeout_Ticks)
+{
+	MYRTOS_ES_t Local_enuErrorState = ES_NoError;
+
+	//a bigger item would be written past *Frame
+	if(Queue_Config->Queue_FIFO.item_size != sizeof(void *))
+		Local_enuErrorState = ES_Error_Queue_Invalid_Storage;
+	else
+		Local_enuErrorState = MyRTOS_Queue_Receive(Task_Ref_Config, Queue_Config, Frame, Timeout_Ticks);
+
+	return Local_enuErrorState;
+}
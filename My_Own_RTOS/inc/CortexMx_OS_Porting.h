@@ -26,7 +26,16 @@ extern unsigned int _eheap;
  */
 void HW_init(void);
 void Trigger_OS_PendSV(void);
+void Clear_OS_PendSV(void);
 unsigned int OS_Start_Ticker(void);
+void OS_Ticker_Start_Period(unsigned int Counts);
+unsigned int OS_Ticker_Suppress(unsigned int No_Ticks);
+unsigned int OS_Ticker_Resume(unsigned int Suppressed_Ticks);
+unsigned int OS_Ticker_Elapsed_Counts(void);
+unsigned int OS_Enter_Critical(void);
+void OS_Exit_Critical(unsigned int Old_BASEPRI);
+unsigned char OS_ISR_Priority_Is_Valid(void);
+void OS_Set_ISR_Priority(unsigned int IRQ_Number, unsigned int Priority);
 
 
 /*
@@ -37,6 +46,17 @@ unsigned int OS_Start_Ticker(void);
 
 #define Main_Stack_Size		3072		//Main Stack Size = 3 KB
 
+#define OS_Ticker_Counts_Per_Tick			8000		//8 MHz --> 8000 count = 1 Millisecond
+
+//BASEPRI value of the kernel critical sections (the priority is in the high bits of the register)
+#define OS_Syscall_BASEPRI_Value			((MyRTOS_Max_Syscall_Interrupt_Priority) << (8 - __NVIC_PRIO_BITS))
+
+//the same value in memory for the assembly code (PendSV_Handler)
+extern const unsigned int OS_Syscall_BASEPRI;
+
+//SysTick counter is 24-bit so it can't count more than 2097 ticks at one time
+#define OS_Ticker_Max_Suppressed_Ticks		(SysTick_LOAD_RELOAD_Msk / OS_Ticker_Counts_Per_Tick)
+
 /*
  * Function: OS_Set_PSP_Val
  * How:
@@ -0,0 +1,48 @@
+/*
+ * MYRTOS_Atomic.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: agent
+ */
+
+#ifndef INC_MYRTOS_ATOMIC_H_
+#define INC_MYRTOS_ATOMIC_H_
+
+/*
+ * ------------
+ * | Includes |
+ * ------------
+ */
+#include "stdint.h"
+
+/*
+ * Atomic Implementation:
+ * --> Cortex-M3/M4 (ARMv7-M): exclusive access LDREX/STREX from cmsis_gcc.h
+ *     --> if an interrupt (or a context switch) comes between them the STREX fails and we try again
+ *         so no interrupt is disabled and no SVC is needed
+ * --> other targets (ex: host simulation): the __atomic builtins of the compiler
+ * all operations are full memory barriers (DMB before and after the change)
+ */
+#if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__)
+#include "cmsis_compiler.h"
+#define Atomic_Use_Exclusive_Access		1
+#define Atomic_Memory_Barrier()			__DMB()
+#else
+#define Atomic_Use_Exclusive_Access		0
+#define Atomic_Memory_Barrier()			__atomic_thread_fence(__ATOMIC_SEQ_CST)
+#endif
+
+/*
+ * ======================================================================
+ * 			APIs Supported by "MY RTOS Atomic"
+ * ======================================================================
+ */
+uint32_t Atomic_Load(volatile uint32_t *P_value);
+void Atomic_Store(volatile uint32_t *P_value, uint32_t value);
+uint32_t Atomic_Exchange(volatile uint32_t *P_value, uint32_t value);
+uint8_t Atomic_Compare_Exchange(volatile uint32_t *P_value, uint32_t *P_expected, uint32_t desired);
+uint32_t Atomic_Fetch_Add(volatile uint32_t *P_value, uint32_t value);
+uint32_t Atomic_Fetch_Or(volatile uint32_t *P_value, uint32_t value);
+uint32_t Atomic_Fetch_And(volatile uint32_t *P_value, uint32_t value);
+
+#endif /* INC_MYRTOS_ATOMIC_H_ */
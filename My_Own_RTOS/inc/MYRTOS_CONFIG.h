@@ -0,0 +1,104 @@
+/*
+ * MYRTOS_CONFIG.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: agent
+ */
+
+#ifndef INC_MYRTOS_CONFIG_H_
+#define INC_MYRTOS_CONFIG_H_
+
+/*
+ * ======================================================================
+ * 			Configuration of "MY RTOS"
+ * ======================================================================
+ */
+
+/*
+ * Number of priority levels (0 --> highest priority)
+ * we have one ready list for each level and one bit for each level in a 32-bit bitmap
+ * so it can't be more than 32 levels
+ */
+#define MyRTOS_Num_of_Priorities			32
+
+//The IDLE Task always takes the lowest priority level
+#define MyRTOS_IDLE_Task_Priority			(MyRTOS_Num_of_Priorities - 1)
+
+//Default Time Slice (ticks) of Round Robin between the tasks of the same priority
+//it can be changed for each priority at run time by MyRTOS_Set_Time_Slice
+#define MyRTOS_Default_Time_Slice_Ticks		1
+
+/*
+ * EDF Band:
+ * the tasks of EDF_Class share this priority level and they are ordered by their absolute deadline
+ * --> Fixed priority tasks with higher priority (lower number) preempt all EDF tasks
+ * --> Fixed priority tasks with lower priority (higher number) run when no EDF task is ready
+ */
+#define MyRTOS_EDF_Band_Priority			16
+
+/*
+ * Tickless Idle:
+ * 1 --> when only the IDLE Task is ready the periodic ticks are stopped till the next task wakes up
+ * 0 --> SysTick interrupt comes every tick all the time
+ */
+#define MyRTOS_Tickless_Idle_Enable			0
+
+//Don't stop the ticks if the CPU will sleep less than this number of ticks
+#define MyRTOS_Tickless_Min_Idle_Ticks		2
+
+/*
+ * Context Switch Benchmark:
+ * 1 --> PendSV_Handler measures its cycles with the DWT cycle counter
+ *       (OS_Context_Switch_Benchmark.Last_Cycles & Max_Cycles --> read them by the debugger)
+ * 0 --> no measurement
+ */
+#define MyRTOS_Context_Switch_Benchmark		0
+
+/*
+ * Privileged Fast Path:
+ * 1 --> privileged callers (startup code before the OS starts or tasks with Task_Privileged = 1)
+ *       call the kernel services directly inside a short BASEPRI critical section (no SVC exception)
+ *       and only unprivileged tasks enter the kernel by SVC
+ * 0 --> all callers enter the kernel by SVC
+ */
+#define MyRTOS_Privileged_Fast_Path			0
+
+/*
+ * Kernel Call Benchmark:
+ * 1 --> MyRTOS_Run_Kernel_Call_Benchmark() measures the cycles of activate, terminate and mutex calls
+ *       by SVC and by the direct call (OS_Kernel_Call_Benchmark --> read it by the debugger)
+ * 0 --> no measurement
+ */
+#define MyRTOS_Kernel_Call_Benchmark		0
+
+/*
+ * EDF Order Check:
+ * 1 --> MyRTOS_Run_EDF_Order_Check() checks that a job released at the end of a relative wait and a new job
+ *       released at the same tick are ordered in the EDF band by their real deadlines
+ * 0 --> no check
+ */
+#define MyRTOS_EDF_Order_Check				0
+
+/*
+ * Max Syscall Interrupt Priority: (NVIC priority --> 0 is the highest)
+ * --> the kernel critical sections set BASEPRI to this priority so they mask only the interrupts
+ *     with this priority or lower (SysTick, PendSV and the interrupts that use the OS APIs)
+ * --> interrupts with a higher priority (lower number) are never masked by the OS (zero jitter)
+ *     but they must not call any OS API
+ * --> SVC takes this priority too
+ */
+#define MyRTOS_Max_Syscall_Interrupt_Priority	5
+
+#if (MyRTOS_Num_of_Priorities > 32)
+#error "MyRTOS_Num_of_Priorities can't be more than 32 (bits of the ready bitmap)"
+#endif
+
+#if (MyRTOS_EDF_Band_Priority >= MyRTOS_IDLE_Task_Priority)
+#error "MyRTOS_EDF_Band_Priority must be higher than the priority of the IDLE Task"
+#endif
+
+#if (MyRTOS_Max_Syscall_Interrupt_Priority == 0)
+#error "MyRTOS_Max_Syscall_Interrupt_Priority can't be 0 (BASEPRI = 0 doesn't mask any interrupt)"
+#endif
+
+#endif /* INC_MYRTOS_CONFIG_H_ */
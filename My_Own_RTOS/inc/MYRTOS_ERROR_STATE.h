@@ -15,11 +15,25 @@
 typedef enum
 {
 	ES_NoError,
-	ES_Ready_Queue_Init_Error,
+	ES_Error_Invalid_Priority,
 	ES_Error_Task_Exceeded_Stack_Size,
-	ES_Error_Bubble_Sort,
 	ES_Error_SysTick_counting,
-	ES_Error_Many_User_Mutex
+	ES_Error_Period_Overrun,
+	ES_Error_Invalid_ISR_Priority,
+	ES_Error_Mutex_Ceiling_Violation,
+	ES_Error_Mutex_Busy,
+	ES_Error_Timeout,
+	ES_Error_Semaphore_Empty,
+	ES_Error_Semaphore_Full,
+	ES_Error_Queue_Invalid_Storage,
+	ES_Error_Queue_Full,
+	ES_Error_Queue_Empty,
+	ES_Error_Task_Blocked,
+	ES_Error_Task_Table_Full,
+	ES_Error_Event_Invalid_Mask,
+	ES_Error_EDF_Order,
+	ES_Error_In_Critical,
+	ES_Error_Semaphore_Invalid_Count
 }MYRTOS_ES_t;
 
 #endif /* INC_MYRTOS_ERROR_STATE_H_ */
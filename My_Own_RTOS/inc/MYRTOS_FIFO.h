@@ -17,20 +17,22 @@
 #include "stdint.h"
 #include "stdlib.h"
 #include "string.h"
-#include "Scheduler.h"
-
-//select element type of fifo
-#define FIFO_element_type 	Task_Ref_t*
 
 //-*-*-*-*-*-*-*-*-*-*-*-*-*-*-
 //FIFO Definition:
 //-*-*-*-*-*-*-*-*-*-*-*-*-*-*-
+/*
+ * the fifo is generic --> each item has item_size bytes and the items are copied in and out
+ * the buffer is given by the user (static storage) and it must have length * item_size bytes
+ * head and tail are indices of the next item to enqueue and to dequeue (0 .. length - 1)
+ */
 typedef struct
 {
-	FIFO_element_type *base;
-	FIFO_element_type *tail;
-	FIFO_element_type *head;
+	uint8_t *base;
+	uint32_t head;
+	uint32_t tail;
 	uint32_t length;
+	uint32_t item_size;
 	uint32_t count;
 }FIFO_Buf_t;
 
@@ -50,11 +52,10 @@ typedef enum
  * 			APIs Supported by "MY RTOS FIFO"
  * ======================================================================
  */
-FIFO_Buf_Status FIFO_init (FIFO_Buf_t *P_fifo, FIFO_element_type *buf, uint32_t length);
+FIFO_Buf_Status FIFO_init (FIFO_Buf_t *P_fifo, void *buf, uint32_t length, uint32_t item_size);
 FIFO_Buf_Status FIFO_IS_FULL(FIFO_Buf_t *P_fifo);
 FIFO_Buf_Status FIFO_IS_EMPTY(FIFO_Buf_t *P_fifo);
-FIFO_Buf_Status FIFO_Enqueue_Item(FIFO_Buf_t *P_fifo, FIFO_element_type item);
-FIFO_Buf_Status FIFO_Dequeue_Item(FIFO_Buf_t *P_fifo, FIFO_element_type *item);
-void FIFO_Print (FIFO_Buf_t *P_fifo);
+FIFO_Buf_Status FIFO_Enqueue_Item(FIFO_Buf_t *P_fifo, const void *item);
+FIFO_Buf_Status FIFO_Dequeue_Item(FIFO_Buf_t *P_fifo, void *item);
 
 #endif /* INC_MYRTOS_FIFO_H_ */
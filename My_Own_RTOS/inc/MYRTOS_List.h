@@ -0,0 +1,66 @@
+/*
+ * MYRTOS_List.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: agent
+ */
+
+#ifndef INC_MYRTOS_LIST_H_
+#define INC_MYRTOS_LIST_H_
+
+/*
+ * ------------
+ * | Includes |
+ * ------------
+ */
+#include "stddef.h"
+
+//-*-*-*-*-*-*-*-*-*-*-*-*-*-*-
+//List Node Definition:
+//-*-*-*-*-*-*-*-*-*-*-*-*-*-*-
+/*
+ * the node is embedded inside the object that we need to link (intrusive list)
+ * so adding or removing an object never needs memory allocation and removing is O(1)
+ */
+typedef struct List_Node
+{
+	struct List_Node *Next;
+	struct List_Node *Prev;
+	unsigned int Item_Value;	//Key of ordered lists (priority, deadline, ...)
+	void *Owner;				//Object which contains this node (Task, Mutex, ...)
+	struct List *Container;		//List which contains this node now (NULL --> not linked)
+}List_Node_t;
+
+//-*-*-*-*-*-*-*-*-*-*-*-*-*-*-
+//List Definition:
+//-*-*-*-*-*-*-*-*-*-*-*-*-*-*-
+typedef struct List
+{
+	List_Node_t *Head;
+	List_Node_t *Tail;
+	unsigned int Count;
+}List_t;
+
+/*
+ * ======================================================================
+ * 			APIs Supported by "MY RTOS List"
+ * ======================================================================
+ */
+void List_Init(List_t *P_List);
+void List_Node_Init(List_Node_t *P_Node, void *Owner);
+void List_Insert_Head(List_t *P_List, List_Node_t *P_Node);
+void List_Insert_Tail(List_t *P_List, List_Node_t *P_Node);
+void List_Insert_Before(List_t *P_List, List_Node_t *P_Position, List_Node_t *P_Node);
+void List_Insert_Ordered(List_t *P_List, List_Node_t *P_Node);
+void List_Remove(List_Node_t *P_Node);
+
+/*
+ * ======================================================================
+ * 			Macros Supported by "MY RTOS List"
+ * ======================================================================
+ */
+#define List_Is_Empty(P_List)				((P_List)->Count == 0)
+#define List_Head_Owner(P_List)				((P_List)->Head->Owner)
+#define List_Node_Is_Linked(P_Node)			((P_Node)->Container != NULL)
+
+#endif /* INC_MYRTOS_LIST_H_ */
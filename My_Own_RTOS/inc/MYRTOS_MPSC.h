@@ -0,0 +1,75 @@
+/*
+ * MYRTOS_MPSC.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: agent
+ */
+
+#ifndef INC_MYRTOS_MPSC_H_
+#define INC_MYRTOS_MPSC_H_
+
+/*
+ * ------------
+ * | Includes |
+ * ------------
+ */
+#include "stdint.h"
+#include "stddef.h"
+#include "MYRTOS_Atomic.h"
+
+//-*-*-*-*-*-*-*-*-*-*-*-*-*-*-
+//MPSC Slot Definition:
+//-*-*-*-*-*-*-*-*-*-*-*-*-*-*-
+/*
+ * each slot has a sequence number that tells who owns it now:
+ *     sequence == position             --> the slot is free for the producer of this position
+ *     sequence == position + 1         --> the item is written and the consumer can read it
+ *     sequence == position + length    --> the consumer read it so it's free for the next round
+ */
+typedef struct
+{
+	volatile uint32_t sequence;
+	uint32_t data;				//event (ID, value or pointer) posted by the producer
+}MPSC_Slot_t;
+
+//-*-*-*-*-*-*-*-*-*-*-*-*-*-*-
+//MPSC Queue Definition:
+//-*-*-*-*-*-*-*-*-*-*-*-*-*-*-
+/*
+ * Multi Producer / Single Consumer lock-free queue:
+ * --> producers (ISRs of any priority or tasks) reserve a position by compare and swap on head
+ *     (Atomic_Compare_Exchange --> LDREX/STREX on Cortex-M3)
+ *     so an interrupt that posts in the middle of another post takes the next position
+ *     and no interrupt is disabled
+ * --> the consumer (one task) is the only one that writes tail
+ * --> head and tail are free running counters and length is a power of two (index = counter & mask)
+ */
+typedef struct
+{
+	MPSC_Slot_t *slots;
+	uint32_t mask;				//length - 1
+	volatile uint32_t head;		//Producers --> next position to reserve
+	volatile uint32_t tail;		//Consumer only --> next position to read
+}MPSC_Buf_t;
+
+//-*-*-*-*-*-*-*-*-*-*-*-*-*-*-
+//MPSC States:
+//-*-*-*-*-*-*-*-*-*-*-*-*-*-*-
+typedef enum
+{
+	MPSC_no_error,
+	MPSC_full,
+	MPSC_empty,
+	MPSC_null
+}MPSC_Buf_Status;
+
+/*
+ * ======================================================================
+ * 			APIs Supported by "MY RTOS MPSC"
+ * ======================================================================
+ */
+MPSC_Buf_Status MPSC_init(MPSC_Buf_t *P_queue, MPSC_Slot_t *slots, uint32_t length);
+MPSC_Buf_Status MPSC_Post(MPSC_Buf_t *P_queue, uint32_t item);
+MPSC_Buf_Status MPSC_Get(MPSC_Buf_t *P_queue, uint32_t *item);
+
+#endif /* INC_MYRTOS_MPSC_H_ */
@@ -0,0 +1,78 @@
+/*
+ * MYRTOS_Ring.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: agent
+ */
+
+#ifndef INC_MYRTOS_RING_H_
+#define INC_MYRTOS_RING_H_
+
+/*
+ * ------------
+ * | Includes |
+ * ------------
+ */
+#include "stdint.h"
+#include "string.h"
+#include "MYRTOS_Atomic.h"
+
+//-*-*-*-*-*-*-*-*-*-*-*-*-*-*-
+//Ring Definition:
+//-*-*-*-*-*-*-*-*-*-*-*-*-*-*-
+/*
+ * Single Producer / Single Consumer lock-free ring:
+ * --> head is written only by the producer and tail is written only by the consumer
+ *     so one ISR and one task (or two tasks) can use it together without any lock
+ * --> head and tail are free running counters (they are never wrapped) so:
+ *         number of items = head - tail  (right after the counters wrap too)
+ *         index of item   = counter & mask  (length is a power of two --> no division and no compare)
+ *
+ *          tail & mask               head & mask
+ *              |                         |
+ *              v                         v
+ *      ---------------------------------------------
+ *      |     | item | item | item | item |     |   |
+ *      ---------------------------------------------
+ */
+typedef struct
+{
+	uint8_t *base;
+	uint32_t item_size;
+	uint32_t mask;				//length - 1
+	volatile uint32_t head;		//Producer only --> counter of the pushed items
+	volatile uint32_t tail;		//Consumer only --> counter of the popped items
+}Ring_Buf_t;
+
+//-*-*-*-*-*-*-*-*-*-*-*-*-*-*-
+//Ring States:
+//-*-*-*-*-*-*-*-*-*-*-*-*-*-*-
+typedef enum
+{
+	Ring_no_error,
+	Ring_full,
+	Ring_empty,
+	Ring_null
+}Ring_Buf_Status;
+
+/*
+ * ======================================================================
+ * 			APIs Supported by "MY RTOS Ring"
+ * ======================================================================
+ */
+Ring_Buf_Status Ring_init(Ring_Buf_t *P_ring, void *buf, uint32_t length, uint32_t item_size);
+Ring_Buf_Status Ring_Push(Ring_Buf_t *P_ring, const void *item);
+Ring_Buf_Status Ring_Pop(Ring_Buf_t *P_ring, void *item);
+uint32_t Ring_Push_N(Ring_Buf_t *P_ring, const void *items, uint32_t n);
+uint32_t Ring_Pop_N(Ring_Buf_t *P_ring, void *items, uint32_t n);
+
+/*
+ * ======================================================================
+ * 			Macros Supported by "MY RTOS Ring"
+ * ======================================================================
+ */
+#define Ring_Length(P_ring)			((P_ring)->mask + 1)
+#define Ring_Count(P_ring)			((uint32_t)((P_ring)->head - (P_ring)->tail))
+#define Ring_Free(P_ring)			(Ring_Length(P_ring) - Ring_Count(P_ring))
+
+#endif /* INC_MYRTOS_RING_H_ */
@@ -15,6 +15,9 @@
  */
 #include "CortexMx_OS_Porting.h"
 #include "MYRTOS_ERROR_STATE.h"
+#include "MYRTOS_CONFIG.h"
+#include "MYRTOS_List.h"
+#include "MYRTOS_FIFO.h"
 
 //-*-*-*-*-*-*-*-*-*-*-*-*-*-*-
 //Task AutoStart States:
@@ -36,6 +39,15 @@ enum Task_State_t
 	Running_State
 };
 
+//-*-*-*-*-*-*-*-*-*-*-*-*-*-*-
+//Task Scheduling Class:
+//-*-*-*-*-*-*-*-*-*-*-*-*-*-*-
+enum Task_Scheduling_Class_t
+{
+	Fixed_Priority_Class,		//Task runs by its own Task_Priority
+	EDF_Class					//Task runs in the EDF band by its absolute deadline (Earliest Deadline First)
+};
+
 //-*-*-*-*-*-*-*-*-*-*-*-*-*-*-
 //Task Blocking or Not:
 //-*-*-*-*-*-*-*-*-*-*-*-*-*-*-
@@ -45,6 +57,27 @@ enum Blocking_t
 	Blocking_Enable
 };
 
+//-*-*-*-*-*-*-*-*-*-*-*-*-*-*-
+//Task Notification States:
+//-*-*-*-*-*-*-*-*-*-*-*-*-*-*-
+enum Task_Notify_State_t
+{
+	Notify_Not_Waiting,		//no notification is received and the task doesn't wait for it
+	Notify_Waiting,			//the task is blocked till a notification comes
+	Notify_Pending			//a notification is received and the task didn't take it yet
+};
+
+//-*-*-*-*-*-*-*-*-*-*-*-*-*-*-
+//Task Notification Actions: (how the notification changes the value of the task)
+//-*-*-*-*-*-*-*-*-*-*-*-*-*-*-
+enum Notify_Action_t
+{
+	MyRTOS_Notify_No_Action,	//only wakes up the task
+	MyRTOS_Notify_Set_Bits,		//value |= bits (light event flags)
+	MyRTOS_Notify_Increment,	//value++ (light counting semaphore)
+	MyRTOS_Notify_Overwrite		//value = new value (light mailbox)
+};
+
 //-*-*-*-*-*-*-*-*-*-*-*-*-*-*-
 //Task Timing Waiting Configuration:
 //-*-*-*-*-*-*-*-*-*-*-*-*-*-*-
@@ -59,22 +92,53 @@ struct Task_Timing_Waiting_t
 //-*-*-*-*-*-*-*-*-*-*-*-*-*-*-
 typedef struct
 {
+	//This is the last address of PSP(SP) before we switch to another task
+	//it must be the first member because PendSV_Handler (assembly) reads it at offset 0
+	unsigned int *Current_PSP_Task;	//Not Entered by user
+
 	unsigned int  Task_Stack_Size;
 	unsigned char Task_Priority;
+	unsigned char Task_Base_Priority;	//Not Entered by user --> priority of the task without inheritance
 	void (*PF_Task_Entry) (void);	//Pointer to Task C Function
 	enum Task_AutoStart_t Task_AutoStart;
+	unsigned char Task_Privileged;	//1 --> the task runs privileged (it calls the kernel without SVC)
 
 	unsigned int _S_PSP_Task;	//Not Entered by user
 	unsigned int _E_PSP_Task;	//Not Entered by user
-	unsigned int *Current_PSP_Task;	//This is the last address of PSP(SP) before we switch to another task
 
 	char Task_Name[30];
 
 	enum Task_State_t Task_State;	//Not Entered by user
 
 	struct Task_Timing_Waiting_t Task_Timing_Waiting;
+
+	unsigned int Task_Period;			//Periodic task --> ticks between two releases (0 --> not periodic)
+	unsigned int Task_Offset;			//Periodic task --> tick of the first release (counted from the start of the OS)
+	unsigned int Task_Release_Tick;		//Not Entered by user --> tick of the release of the current periodic job (phase anchor)
+	unsigned int Task_Wake_Tick;		//Not Entered by user --> tick that the next job is released at (release tick or end of a relative wait)
+
+	enum Task_Scheduling_Class_t Task_Scheduling_Class;
+	unsigned int Task_Relative_Deadline;	//EDF only --> ticks from the release of the job to its deadline
+	unsigned int Task_Absolute_Deadline;	//Not Entered by user --> tick of the deadline of the current job
+
+	List_Node_t Task_State_Node;	//Not Entered by user --> links the task to the ready list of its priority
+	List_Node_t Task_Event_Node;	//Not Entered by user --> links the task to the wait list of a mutex, semaphore, event group or queue
+
+	struct Mutex_Configuration *Task_Waiting_Mutex;	//Not Entered by user --> mutex that the task waits for
+	MYRTOS_ES_t Task_Wait_Result;					//Not Entered by user --> result of the last wait (got it or timeout)
+	unsigned int Task_Event_Mask;					//Not Entered by user --> flags that the task waits for (or notification bits to clear)
+	unsigned int Task_Event_Flags;					//Not Entered by user --> flags of the group (or notification value) when the wait is finished
+	unsigned char Task_Event_Options;				//Not Entered by user --> MyRTOS_Event_Wait_All | MyRTOS_Event_Clear_On_Exit
+	void *Task_Wait_Buffer;							//Not Entered by user --> item that the task sends (or buffer that receives it) when it waits for a queue
+	List_t Task_Held_Mutexes;						//Not Entered by user --> mutexes that the task holds now
+
+	unsigned int Task_Notify_Value;					//Not Entered by user --> notification value (changed by the notify action)
+	enum Task_Notify_State_t Task_Notify_State;		//Not Entered by user
 }Task_Ref_t;
 
+//Timeout of the APIs that can wait --> wait till the object is available
+#define MyRTOS_Wait_Forever		0xFFFFFFFFUL
+
 //-*-*-*-*-*-*-*-*-*-*-*-*-*-*-
 //Mutex States: we use binary semaphore
 //-*-*-*-*-*-*-*-*-*-*-*-*-*-*-
@@ -84,19 +148,70 @@ typedef enum
 	Mutex_Released
 }Binary_Semaphore_State_t;
 
+//-*-*-*-*-*-*-*-*-*-*-*-*-*-*-
+//Mutex Protocols: (against priority inversion)
+//-*-*-*-*-*-*-*-*-*-*-*-*-*-*-
+enum Mutex_Protocol_t
+{
+	Mutex_Priority_Inheritance,		//the holder takes the priority of the waiting tasks
+	Mutex_Priority_Ceiling			//the holder takes the ceiling priority once it acquires the mutex
+};
+
 //-*-*-*-*-*-*-*-*-*-*-*-*-*-*-
 //Mutex Configuration:
 //-*-*-*-*-*-*-*-*-*-*-*-*-*-*-
-typedef struct
+typedef struct Mutex_Configuration
 {
 	void *Data;	//this to be generic to any data type not only to character
 	unsigned int Data_Size;
 	Task_Ref_t *Current_Task_User;
-	Task_Ref_t *Next_Task_User;
+	List_t Waiting_Tasks;			//Not Entered by user --> tasks that wait for the mutex (highest priority first)
+	List_Node_t Mutex_Holder_Node;	//Not Entered by user --> links the mutex to the held list of its task
 	char Mutex_Name[30];
 	Binary_Semaphore_State_t mutex_state;	//Not Entered by user
+	enum Mutex_Protocol_t Mutex_Protocol;
+	unsigned char Mutex_Ceiling_Priority;	//Priority Ceiling only --> highest priority of the tasks that use the mutex
 }Mutex_Configuration_t;
 
+//-*-*-*-*-*-*-*-*-*-*-*-*-*-*-
+//Counting Semaphore Configuration:
+//-*-*-*-*-*-*-*-*-*-*-*-*-*-*-
+typedef struct Semaphore_Configuration
+{
+	unsigned int Semaphore_Count;		//Not Entered by user --> number of available tokens
+	unsigned int Semaphore_Max_Count;	//give fails when the count reaches it
+	List_t Waiting_Tasks;				//Not Entered by user --> tasks that wait for a token (highest priority first)
+	char Semaphore_Name[30];
+}Semaphore_Configuration_t;
+
+//-*-*-*-*-*-*-*-*-*-*-*-*-*-*-
+//Event Group Configuration:
+//-*-*-*-*-*-*-*-*-*-*-*-*-*-*-
+typedef struct Event_Group_Configuration
+{
+	unsigned int Event_Flags;			//Not Entered by user --> 32 event flags (one bit for each event)
+	List_t Waiting_Tasks;				//Not Entered by user --> tasks that wait for flags (highest priority first)
+	char Event_Group_Name[30];
+}Event_Group_Configuration_t;
+
+//-*-*-*-*-*-*-*-*-*-*-*-*-*-*-
+//Message Queue Configuration:
+//-*-*-*-*-*-*-*-*-*-*-*-*-*-*-
+typedef struct Queue_Configuration
+{
+	FIFO_Buf_t Queue_FIFO;				//Not Entered by user --> items in the storage of the user
+	List_t Waiting_Senders;				//Not Entered by user --> tasks that wait for a free place (highest priority first)
+	List_t Waiting_Receivers;			//Not Entered by user --> tasks that wait for an item (highest priority first)
+	char Queue_Name[30];
+}Queue_Configuration_t;
+
+//Bytes of the storage of a queue (the user reserves it as a static array)
+#define MyRTOS_Queue_Storage_Size(Length, Item_Size)		((Length) * (Item_Size))
+
+//Wait Options of the event flags: (they can be ORed)
+#define MyRTOS_Event_Wait_Any		0x00	//the wait is finished when any flag of the mask is set
+#define MyRTOS_Event_Wait_All		0x01	//the wait is finished when all flags of the mask are set
+#define MyRTOS_Event_Clear_On_Exit	0x02	//the flags of the mask are cleared when the wait is finished
 
 /*
  * ======================================================================
@@ -108,10 +223,62 @@ void MyRTOS_Task_Init(Task_Ref_t *Task_Ref_Config, unsigned int Stack_Size, void
 MYRTOS_ES_t MyRTOS_Create_Task(Task_Ref_t *Task_Ref_Config);
 MYRTOS_ES_t MyRTOS_Activate_Task(Task_Ref_t *Task_Ref_Config);
 MYRTOS_ES_t MyRTOS_Terminate_Task(Task_Ref_t *Task_Ref_Config);
+MYRTOS_ES_t MyRTOS_Activate_Task_FromISR(Task_Ref_t *Task_Ref_Config, unsigned char *Higher_Priority_Task_Woken);
+void MyRTOS_Yield_FromISR(unsigned char Higher_Priority_Task_Woken);
+MYRTOS_ES_t MyRTOS_Set_ISR_Priority(unsigned int IRQ_Number, unsigned int Priority);
 MYRTOS_ES_t MyRTOS_Start_OS(void);
 MYRTOS_ES_t MyRTOS_Task_Wait(unsigned int No_Ticks, Task_Ref_t *Task_Ref_Config);
+MYRTOS_ES_t MyRTOS_Task_Delay_Until(unsigned int *Previous_Wake_Tick, unsigned int Period_Ticks, Task_Ref_t *Task_Ref_Config);
+MYRTOS_ES_t MyRTOS_Task_Wait_Next_Period(Task_Ref_t *Task_Ref_Config);
 void MyRTOS_Mutex_Init(Mutex_Configuration_t *Mutex_Ref_Config, void *PayLoad, unsigned int PayLoad_Size, char *MUTEX_NAME);
+void MyRTOS_Mutex_Init_Ceiling(Mutex_Configuration_t *Mutex_Ref_Config, void *PayLoad, unsigned int PayLoad_Size, char *MUTEX_NAME, unsigned char Ceiling_Priority);
 MYRTOS_ES_t MyRTOS_Acquire_Mutex(Task_Ref_t *Task_Ref_Config, Mutex_Configuration_t *Mutex_Config);
+MYRTOS_ES_t MyRTOS_Try_Acquire_Mutex(Task_Ref_t *Task_Ref_Config, Mutex_Configuration_t *Mutex_Config);
+MYRTOS_ES_t MyRTOS_Acquire_Mutex_Timeout(Task_Ref_t *Task_Ref_Config, Mutex_Configuration_t *Mutex_Config, unsigned int Timeout_Ticks);
 void MyRTOS_Release_Mutex(Mutex_Configuration_t *Mutex_Config);
+MYRTOS_ES_t MyRTOS_Semaphore_Init(Semaphore_Configuration_t *Semaphore_Config, unsigned int Initial_Count, unsigned int Max_Count, char *SEMAPHORE_NAME);
+MYRTOS_ES_t MyRTOS_Take_Semaphore(Task_Ref_t *Task_Ref_Config, Semaphore_Configuration_t *Semaphore_Config, unsigned int Timeout_Ticks);
+MYRTOS_ES_t MyRTOS_Give_Semaphore(Semaphore_Configuration_t *Semaphore_Config);
+MYRTOS_ES_t MyRTOS_Give_Semaphore_FromISR(Semaphore_Configuration_t *Semaphore_Config, unsigned char *Higher_Priority_Task_Woken);
+void MyRTOS_Event_Group_Init(Event_Group_Configuration_t *Event_Group_Config, char *EVENT_GROUP_NAME);
+MYRTOS_ES_t MyRTOS_Wait_Event_Flags(Task_Ref_t *Task_Ref_Config, Event_Group_Configuration_t *Event_Group_Config, unsigned int Mask, unsigned char Options, unsigned int Timeout_Ticks, unsigned int *Flags);
+void MyRTOS_Set_Event_Flags(Event_Group_Configuration_t *Event_Group_Config, unsigned int Mask);
+MYRTOS_ES_t MyRTOS_Set_Event_Flags_FromISR(Event_Group_Configuration_t *Event_Group_Config, unsigned int Mask, unsigned char *Higher_Priority_Task_Woken);
+void MyRTOS_Clear_Event_Flags(Event_Group_Configuration_t *Event_Group_Config, unsigned int Mask);
+void MyRTOS_Task_Notify(Task_Ref_t *Task_Ref_Config, unsigned int Value, enum Notify_Action_t Action);
+MYRTOS_ES_t MyRTOS_Task_Notify_FromISR(Task_Ref_t *Task_Ref_Config, unsigned int Value, enum Notify_Action_t Action, unsigned char *Higher_Priority_Task_Woken);
+MYRTOS_ES_t MyRTOS_Task_Notify_Wait(Task_Ref_t *Task_Ref_Config, unsigned int Clear_On_Exit_Mask, unsigned int Timeout_Ticks, unsigned int *Value);
+MYRTOS_ES_t MyRTOS_Queue_Init(Queue_Configuration_t *Queue_Config, void *Storage, unsigned int Length, unsigned int Item_Size, char *QUEUE_NAME);
+MYRTOS_ES_t MyRTOS_Queue_Send(Task_Ref_t *Task_Ref_Config, Queue_Configuration_t *Queue_Config, const void *Item, unsigned int Timeout_Ticks);
+MYRTOS_ES_t MyRTOS_Queue_Send_FromISR(Queue_Configuration_t *Queue_Config, const void *Item, unsigned char *Higher_Priority_Task_Woken);
+MYRTOS_ES_t MyRTOS_Queue_Receive(Task_Ref_t *Task_Ref_Config, Queue_Configuration_t *Queue_Config, void *Item, unsigned int Timeout_Ticks);
+MYRTOS_ES_t MyRTOS_Queue_Send_Pointer(Task_Ref_t *Task_Ref_Config, Queue_Configuration_t *Queue_Config, void *Frame, unsigned int Timeout_Ticks);
+MYRTOS_ES_t MyRTOS_Queue_Send_Pointer_FromISR(Queue_Configuration_t *Queue_Config, void *Frame, unsigned char *Higher_Priority_Task_Woken);
+MYRTOS_ES_t MyRTOS_Queue_Receive_Pointer(Task_Ref_t *Task_Ref_Config, Queue_Configuration_t *Queue_Config, void **Frame, unsigned int Timeout_Ticks);
+MYRTOS_ES_t MyRTOS_Set_Time_Slice(unsigned char Priority, unsigned int No_Ticks);
+void MyRTOS_Get_Context_Switch_Count(unsigned int *Switch_Count, unsigned int *Avoided_Count);
+unsigned long long MyRTOS_Get_Tick_Count(void);
+MYRTOS_ES_t MyRTOS_Get_Timestamp(unsigned long long *Timestamp);
+void MyRTOS_Enter_Critical(void);
+void MyRTOS_Exit_Critical(void);
+unsigned int MyRTOS_Enter_Critical_FromISR(void);
+void MyRTOS_Exit_Critical_FromISR(unsigned int Old_Mask);
+#if (MyRTOS_Kernel_Call_Benchmark == 1)
+void MyRTOS_Run_Kernel_Call_Benchmark(Task_Ref_t *Task_Ref_Config, Mutex_Configuration_t *Mutex_Config);
+#endif
+#if (MyRTOS_EDF_Order_Check == 1)
+MYRTOS_ES_t MyRTOS_Run_EDF_Order_Check(Task_Ref_t *Delayed_Task, Task_Ref_t *Released_Task);
+#endif
+
+
+/*
+ * ======================================================================
+ * 			Kernel Functions used by "CortexMx OS Porting"
+ * ======================================================================
+ */
+void OS_Tickless_Idle_Exit(void);
+void MyRTOS_Update_Waiting_Time(void);
+void OS_Round_Robin_Rotate(void);
+unsigned char OS_Decide_What_Next(void);
 
 #endif /* INC_SCHEDULER_H_ */
@@ -0,0 +1,122 @@
+/*
+ * atomic_stress.c
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: agent
+ *
+ * Host stress test for MYRTOS_Atomic (the __atomic fallback):
+ * --> THREADS threads hammer one counter with Atomic_Fetch_Add and with Atomic_Compare_Exchange loops,
+ *     so a lost update shows up as a wrong final count
+ * --> each thread clears / sets its own bit with Atomic_Fetch_And / Atomic_Fetch_Or on shared words
+ * --> each thread hands out tickets through Atomic_Exchange, and every ticket must be seen exactly once
+ */
+
+/*
+ * ------------
+ * | Includes |
+ * ------------
+ */
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "MYRTOS_Atomic.h"
+
+//-*-*-*-*-*-*-*-*-*-*-*-*-*-*-
+//Test Configuration:
+//-*-*-*-*-*-*-*-*-*-*-*-*-*-*-
+#define THREADS			4
+#define ITERATIONS		200000UL		//per thread
+
+#define TICKET_NONE		0xFFFFFFFFUL
+
+volatile uint32_t Counter;
+volatile uint32_t Set_Bits;
+volatile uint32_t Clear_Bits = 0xFFFFFFFFUL;
+volatile uint32_t Mailbox = TICKET_NONE;
+volatile uint32_t Ticket_Seen[THREADS * ITERATIONS];
+
+#define CHECK(cond, ...)	do{ if(!(cond)){ printf("FAIL: " __VA_ARGS__); printf("\n"); exit(1); } }while(0)
+
+/**
+ **********************************************************************************
+ * @function_name	: Take_Ticket
+ * @arguments		: ticket taken out of the mailbox
+ * @brief			: it marks the ticket as seen (once only).
+ **********************************************************************************
+ **/
+void Take_Ticket(uint32_t ticket)
+{
+	if(ticket == TICKET_NONE)
+		return;
+
+	CHECK(ticket < THREADS * ITERATIONS, "bad ticket %u", ticket);
+	CHECK(Atomic_Fetch_Add(&Ticket_Seen[ticket], 1) == 0, "ticket %u taken twice", ticket);
+}
+
+/**
+ **********************************************************************************
+ * @function_name	: Worker
+ * @arguments		: thread ID
+ * @brief			: it runs the counter, bit and ticket operations ITERATIONS times.
+ **********************************************************************************
+ **/
+void *Worker(void *arg)
+{
+	uint32_t id = (uint32_t)(uintptr_t)arg;
+	uint32_t i, expected;
+
+	for(i = 0; i < ITERATIONS; i++)
+	{
+		Atomic_Fetch_Add(&Counter, 1);
+
+		expected = Atomic_Load(&Counter);
+		while(!Atomic_Compare_Exchange(&Counter, &expected, expected + 1));	//expected is refreshed on failure
+
+		//swap my ticket in and whatever was there out
+		Take_Ticket(Atomic_Exchange(&Mailbox, id * ITERATIONS + i));
+	}
+
+	Atomic_Fetch_And(&Clear_Bits, ~(1UL << id));
+	Atomic_Fetch_Or(&Set_Bits, 1UL << id);
+
+	return NULL;
+}
+
+int main(void)
+{
+	pthread_t threads[THREADS];
+	uint32_t expected;
+	uintptr_t i;
+
+	//single thread semantics
+	Atomic_Store(&Counter, 5);
+	CHECK(Atomic_Load(&Counter) == 5, "store/load");
+	CHECK(Atomic_Exchange(&Counter, 7) == 5 && Counter == 7, "exchange");
+	expected = 6;
+	CHECK(!Atomic_Compare_Exchange(&Counter, &expected, 9) && expected == 7 && Counter == 7, "failed CAS");
+	CHECK(Atomic_Compare_Exchange(&Counter, &expected, 9) && Counter == 9, "CAS");
+	CHECK(Atomic_Fetch_Add(&Counter, 3) == 9 && Counter == 12, "fetch add");
+	CHECK(Atomic_Fetch_Or(&Counter, 0x10) == 12 && Counter == 0x1C, "fetch or");
+	CHECK(Atomic_Fetch_And(&Counter, 0x0C) == 0x1C && Counter == 0x0C, "fetch and");
+	Atomic_Store(&Counter, 0);
+
+	for(i = 0; i < THREADS; i++)
+		CHECK(pthread_create(&threads[i], NULL, Worker, (void *)i) == 0, "pthread_create failed");
+
+	for(i = 0; i < THREADS; i++)
+		pthread_join(threads[i], NULL);
+
+	//the last ticket is still in the mailbox
+	Take_Ticket(Atomic_Exchange(&Mailbox, TICKET_NONE));
+
+	CHECK(Counter == 2 * THREADS * ITERATIONS, "counter %u expected %lu (lost update)", Counter, 2 * THREADS * ITERATIONS);
+	CHECK(Set_Bits == (1UL << THREADS) - 1, "set bits 0x%08X", Set_Bits);
+	CHECK(Clear_Bits == (uint32_t)~((1UL << THREADS) - 1), "clear bits 0x%08X", Clear_Bits);
+
+	for(expected = 0; expected < THREADS * ITERATIONS; expected++)
+		CHECK(Ticket_Seen[expected] == 1, "ticket %u lost", expected);
+
+	printf("atomic_stress: %d threads x %lu iterations --> OK\n", THREADS, ITERATIONS);
+
+	return 0;
+}
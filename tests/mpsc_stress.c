@@ -0,0 +1,112 @@
+/*
+ * mpsc_stress.c
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: agent
+ *
+ * Host stress test for the MPSC queue (built with the __atomic fallback of MYRTOS_Atomic):
+ * --> PRODUCERS threads post EVENTS events each, tagged with (producer ID << 24) | sequence
+ * --> one consumer (main thread) reads them back and checks that
+ *     every producer's events arrive in the order they were posted
+ *     and no event is lost or duplicated
+ * --> the queue is small so the producers keep hitting "full" and the counters wrap many times
+ */
+
+/*
+ * ------------
+ * | Includes |
+ * ------------
+ */
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "MYRTOS_MPSC.h"
+
+//-*-*-*-*-*-*-*-*-*-*-*-*-*-*-
+//Test Configuration:
+//-*-*-*-*-*-*-*-*-*-*-*-*-*-*-
+#define PRODUCERS		4
+#define EVENTS			100000UL		//per producer (must fit in 24 bits)
+#define QUEUE_LENGTH	16
+
+#define ID_SHIFT		24
+#define SEQ_MASK		0x00FFFFFFUL
+
+MPSC_Slot_t Slots[QUEUE_LENGTH];
+MPSC_Buf_t Queue;
+
+#define CHECK(cond, ...)	do{ if(!(cond)){ printf("FAIL: " __VA_ARGS__); printf("\n"); exit(1); } }while(0)
+
+/**
+ **********************************************************************************
+ * @function_name	: Producer
+ * @arguments		: producer ID
+ * @brief			: it posts EVENTS tagged events and yields whenever the queue is full.
+ **********************************************************************************
+ **/
+void *Producer(void *arg)
+{
+	uint32_t id = (uint32_t)(uintptr_t)arg;
+	uint32_t seq = 0;
+
+	while(seq < EVENTS)
+	{
+		if(MPSC_Post(&Queue, (id << ID_SHIFT) | seq) == MPSC_no_error)
+			seq++;
+		else
+			sched_yield();
+	}
+
+	return NULL;
+}
+
+int main(void)
+{
+	pthread_t threads[PRODUCERS];
+	uint32_t next[PRODUCERS] = {0};
+	uint32_t received = 0, event, id, seq;
+	uintptr_t i;
+
+	//invalid lengths are rejected
+	CHECK(MPSC_init(&Queue, Slots, 12) == MPSC_null, "length 12 accepted");
+	CHECK(MPSC_init(&Queue, NULL, QUEUE_LENGTH) == MPSC_null, "NULL slots accepted");
+	CHECK(MPSC_init(&Queue, Slots, QUEUE_LENGTH) == MPSC_no_error, "init failed");
+	CHECK(MPSC_Get(&Queue, &event) == MPSC_empty, "new queue is not empty");
+
+	for(i = 0; i < PRODUCERS; i++)
+		CHECK(pthread_create(&threads[i], NULL, Producer, (void *)i) == 0, "pthread_create failed");
+
+	while(received < PRODUCERS * EVENTS)
+	{
+		if(MPSC_Get(&Queue, &event) != MPSC_no_error)
+		{
+			sched_yield();
+			continue;
+		}
+
+		id = event >> ID_SHIFT;
+		seq = event & SEQ_MASK;
+
+		CHECK(id < PRODUCERS, "unknown producer %u (event 0x%08X)", id, event);
+		CHECK(next[id] < EVENTS, "producer %u: extra event %u (duplicated)", id, seq);
+		CHECK(seq == next[id], "producer %u: expected %u got %u (%s)", id, next[id], seq,
+				(seq < next[id]) ? "duplicated / reordered" : "lost / reordered");
+
+		next[id]++;
+		received++;
+	}
+
+	for(i = 0; i < PRODUCERS; i++)
+		pthread_join(threads[i], NULL);
+
+	//nothing left behind after every producer finished
+	CHECK(MPSC_Get(&Queue, &event) == MPSC_empty, "extra event 0x%08X after the last one", event);
+
+	for(i = 0; i < PRODUCERS; i++)
+		CHECK(next[i] == EVENTS, "producer %u: %u of %lu events", (unsigned)i, next[i], EVENTS);
+
+	printf("mpsc_stress: %d producers x %lu events --> OK\n", PRODUCERS, EVENTS);
+
+	return 0;
+}